@@ -0,0 +1,229 @@
+// Offline autotuner for the BMSSP parameters k, t, the block size M and
+// the Dijkstra frame cutoff. The depth l is not tuned: entries are applied
+// to graphs of any size, and l must follow n (BMSSP::top_level), so it is
+// written as 0 and derived per solve.
+//
+//   sssp_autotune [--out FILE] [--runs N] [--default FAMILY] [family=edges.txt ...]
+//
+// Each dataset is an edge list, one edge per line as "u v w" or DIMACS
+// "a u v w" ("c", "p" and "#" lines are skipped); ids are remapped densely.
+// Without datasets, synthetic "random" and "grid" families are tuned. The
+// best settings per family are written to FILE (default sssp_tuning.txt),
+// which the library reads with TuningTable::load or through the
+// SSSP_TUNING_FILE environment variable (entry "default").
+#include "sssp/api.hpp"
+#include "sssp/tuning.hpp"
+#include "test_graphs.hpp"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <random>
+#include <sstream>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+using namespace sssp;
+
+static Graph read_edge_list(const std::string& path) {
+    std::ifstream in(path);
+    if (!in) throw std::runtime_error("Cannot open dataset: " + path);
+    Graph G;
+    std::unordered_map<std::string, VertexId> ids;
+    auto id_of = [&](const std::string& name) {
+        auto [it, fresh] = ids.emplace(name, static_cast<VertexId>(ids.size()));
+        if (fresh) G.add_vertex(it->second);
+        return it->second;
+    };
+    std::string line;
+    while (std::getline(in, line)) {
+        if (line.empty() || line[0] == 'c' || line[0] == 'p' || line[0] == '#') continue;
+        std::istringstream fields(line[0] == 'a' ? line.substr(1) : line);
+        std::string u, v;
+        double w = 0.0;
+        if (!(fields >> u >> v >> w)) throw std::runtime_error("Bad edge line in " + path + ": " + line);
+        const VertexId a = id_of(u), b = id_of(v);
+        G.add_edge(a, b, w);
+    }
+    return G;
+}
+
+static Graph make_random_graph(int n, int m, unsigned seed) {
+    Graph G;
+    for (int i = 0; i < n; ++i) G.add_vertex(i);
+    std::mt19937 rng(seed);
+    std::uniform_int_distribution<int> vid(0, n - 1);
+    std::uniform_real_distribution<double> w(0.1, 10.0);
+    for (int i = 0; i < m; ++i) {
+        int u = vid(rng), v = vid(rng);
+        if (u == v) v = (v + 1) % n;
+        G.add_edge(u, v, w(rng));
+    }
+    return G;
+}
+
+struct Family {
+    std::string name;
+    Graph G;
+};
+
+class Tuner {
+public:
+    Tuner(const Graph& G, int runs) : G_(G), runs_(runs) {
+        std::mt19937 rng(3);
+        std::uniform_int_distribution<VertexId> vid(0, static_cast<VertexId>(G.num_vertices() - 1));
+        for (int i = 0; i < runs; ++i) sources_.push_back(vid(rng));
+        for (VertexId s : sources_) {
+            DistState ref;
+            ref.init(G.num_vertices());
+            BaseCase::run(G, INFINITE_WEIGHT, Vertex(s), ref, G.num_vertices());
+            reference_.push_back(std::move(ref.dist));
+        }
+    }
+
+    // Mean ms per solve, or infinity if any distance is wrong
+    double time(const BMSSPParams& p) const {
+        double total = 0.0;
+        for (std::size_t i = 0; i < sources_.size(); ++i) {
+            DistState state;
+            state.init(G_.num_vertices());
+            state.set(sources_[i], 0.0);
+            const std::vector<Vertex> S = {Vertex(sources_[i])};
+            auto t0 = std::chrono::steady_clock::now();
+            BMSSP::run(G_, p, INFINITE_WEIGHT, S, state);
+            total += std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - t0).count();
+            for (VertexId v = 0; v < G_.num_vertices(); ++v) {
+                if (std::abs(state.get(v) - reference_[i][v]) > 1e-6 && state.get(v) != reference_[i][v]) {
+                    return INFINITE_WEIGHT;
+                }
+            }
+        }
+        return total / static_cast<double>(sources_.size());
+    }
+
+private:
+    const Graph& G_;
+    int runs_;
+    std::vector<VertexId> sources_;
+    std::vector<std::vector<Weight>> reference_;
+};
+
+static std::vector<std::size_t> candidates(std::size_t derived) {
+    std::vector<std::size_t> c = {1, 2, 4, 8, 16, derived};
+    std::sort(c.begin(), c.end());
+    c.erase(std::unique(c.begin(), c.end()), c.end());
+    return c;
+}
+
+static BMSSPParams tune(const Family& f, int runs) {
+    const std::size_t n = f.G.num_vertices();
+    Tuner tuner(f.G, runs);
+    BMSSPParams best;
+    best.dijkstra_cutoff = 1;   // tune the recursion itself
+    double best_ms = tuner.time(best);
+    std::cout << f.name << ": n=" << n << " m=" << f.G.num_edges() << ", derived parameters " << best_ms << " ms\n";
+
+    // k and t first with the derived l and block size, then M, the pivot
+    // rule and adaptation for the winner
+    for (std::size_t k : candidates(compute_k(n))) {
+        for (std::size_t t : candidates(compute_t(n))) {
+            BMSSPParams p;
+            p.k = k;
+            p.t = t;
+            p.dijkstra_cutoff = 1;
+            const double ms = tuner.time(p);
+            if (ms < best_ms) {
+                best_ms = ms;
+                best = p;
+            }
+        }
+    }
+    for (std::size_t M : {std::size_t(1), std::size_t(4), std::size_t(16), std::size_t(64), std::size_t(256)}) {
+        BMSSPParams p = best;
+        p.block_size = M;
+        const double ms = tuner.time(p);
+        if (ms < best_ms) {
+            best_ms = ms;
+            best = p;
+        }
+    }
+    for (PivotRule rule : {PivotRule::Projected, PivotRule::Sampled, PivotRule::SkipSmall}) {
+        BMSSPParams p = best;
+        p.pivots = rule;
+        const double ms = tuner.time(p);
+        if (ms < best_ms) {
+            best_ms = ms;
+            best = p;
+        }
+    }
+    BMSSPParams adaptive = best;
+    adaptive.adaptive = true;
+    const double adaptive_ms = tuner.time(adaptive);
+    if (adaptive_ms < best_ms) {
+        best_ms = adaptive_ms;
+        best = adaptive;
+    }
+    std::cout << "  best recursion: k=" << best.k << " t=" << best.t << " M=" << best.block_size
+              << " pivots=" << pivot_rule_name(best.pivots) << (best.adaptive ? " adaptive" : "") << " " << best_ms
+              << " ms\n";
+
+    // Dijkstra frame cutoff: frames that can settle at most this many
+    // vertices skip the recursion. SIZE_MAX runs every frame as Dijkstra.
+    const std::size_t recursion_cutoff = best.dijkstra_cutoff;
+    for (std::size_t cutoff : {std::size_t(256), std::size_t(1024), BMSSP::kDefaultDijkstraCutoff,
+                               std::size_t(16384), std::size_t(65536), std::numeric_limits<std::size_t>::max()}) {
+        BMSSPParams p = best;
+        p.dijkstra_cutoff = cutoff;
+        const double ms = tuner.time(p);
+        std::cout << "  cutoff=" << cutoff << ": " << ms << " ms\n";
+        if (ms < best_ms) {
+            best_ms = ms;
+            best = p;
+        }
+    }
+    if (best.dijkstra_cutoff != recursion_cutoff) std::cout << "  best cutoff: " << best.dijkstra_cutoff << "\n";
+    return best;
+}
+
+int main(int argc, char** argv) {
+    std::string out = "sssp_tuning.txt", default_family;
+    int runs = 3;
+    std::vector<Family> families;
+    try {
+        for (int i = 1; i < argc; ++i) {
+            const std::string arg = argv[i];
+            if (arg == "--out" && i + 1 < argc) out = argv[++i];
+            else if (arg == "--runs" && i + 1 < argc) runs = std::max(1, std::atoi(argv[++i]));
+            else if (arg == "--default" && i + 1 < argc) default_family = argv[++i];
+            else if (arg.find('=') != std::string::npos) {
+                const auto eq = arg.find('=');
+                families.push_back({arg.substr(0, eq), read_edge_list(arg.substr(eq + 1))});
+            } else {
+                std::cerr << "usage: sssp_autotune [--out FILE] [--runs N] [--default FAMILY] [family=edges.txt ...]\n";
+                return 2;
+            }
+        }
+        if (families.empty()) {
+            families.push_back({"random", make_random_graph(5000, 20000, 42)});
+            families.push_back({"grid", test::grid(70, 42)});
+        }
+
+        TuningTable table;
+        for (const auto& f : families) {
+            if (f.G.num_vertices() == 0) continue;
+            table.set(f.name, tune(f, runs));
+        }
+        const std::string fallback = default_family.empty() ? families.front().name : default_family;
+        if (!table.contains(fallback)) throw std::runtime_error("No tuned family named " + fallback);
+        table.set("default", table.lookup(fallback));
+        table.save(out);
+        std::cout << "wrote " << out << " (default = " << fallback << ")\n";
+    } catch (const std::exception& e) {
+        std::cerr << e.what() << "\n";
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,72 @@
+#include "sssp/api.hpp"
+#include "sssp/approximate.hpp"
+#include "sssp/distance_matrix.hpp"
+#include <random>
+#include <iostream>
+#include <chrono>
+#include <cmath>
+
+using namespace sssp;
+
+static Graph make_random_graph(int n, int m) {
+    Graph G;
+    for (int i = 0; i < n; ++i) G.add_vertex(i);
+    std::mt19937 rng(42);
+    std::uniform_int_distribution<int> vid(0, n - 1);
+    std::uniform_real_distribution<double> logw(0.0, std::log(1000.0));   // weights in [1, 1000)
+    for (int i = 0; i < m; ++i) {
+        int u = vid(rng), v = vid(rng); if (u == v) v = (v + 1) % n;
+        G.add_edge(u, v, std::exp(logw(rng)));
+    }
+    return G;
+}
+
+template <typename F>
+static double time_ms(int runs, F&& f) {
+    auto t0 = std::chrono::high_resolution_clock::now();
+    for (int i = 0; i < runs; ++i) f(i);
+    auto t1 = std::chrono::high_resolution_clock::now();
+    return std::chrono::duration<double, std::milli>(t1 - t0).count() / runs;
+}
+
+int main() {
+    const int n = 100000, m = 500000, runs = 5;
+    Graph G = make_random_graph(n, m);
+    std::vector<DistState> exact(runs);
+    double exact_ms = time_ms(runs, [&](int i) { solveSSSP(G, Vertex(i * 997), exact[i]); });
+    // Exact Dijkstra on a flat adjacency (one row of a distance matrix)
+    std::vector<Vertex> all;
+    for (VertexId v = 0; v < G.num_vertices(); ++v) all.push_back(Vertex(v));
+    double dijkstra_ms = time_ms(runs, [&](int i) { (void)distanceMatrix(G, {Vertex(i * 997)}, all, 1); });
+    std::cout << "n=" << n << " m=" << m << ", " << runs << " sources\n"
+              << "exact solveSSSP: " << exact_ms << " ms/source\n"
+              << "exact CSR Dijkstra (incl. adjacency copy): " << dijkstra_ms << " ms/source\n";
+
+    for (double eps : {0.001, 0.01, 0.05, 0.1, 0.5}) {
+        auto t0 = std::chrono::high_resolution_clock::now();
+        ApproximateSSSP engine(G, eps);
+        auto t1 = std::chrono::high_resolution_clock::now();
+        std::vector<DistState> approx(runs);
+        double ms = time_ms(runs, [&](int i) { engine.run(Vertex(i * 997), approx[i]); });
+
+        // Stretch against the exact distances, outside the timed runs
+        double max_stretch = 1.0, sum_stretch = 0.0;
+        std::size_t count = 0;
+        for (int i = 0; i < runs; ++i) {
+            for (VertexId v = 0; v < G.num_vertices(); ++v) {
+                const Weight d = exact[i].get(v);
+                if (d == INFINITE_WEIGHT || d == 0.0) continue;
+                const double r = approx[i].get(v) / d;
+                max_stretch = std::max(max_stretch, r);
+                sum_stretch += r;
+                count++;
+            }
+        }
+        std::cout << "eps=" << eps << ": " << engine.num_weight_classes() << " weight classes, build "
+                  << std::chrono::duration<double, std::milli>(t1 - t0).count() << " ms, " << ms
+                  << " ms/source (" << exact_ms / ms << "x solveSSSP, " << dijkstra_ms / ms
+                  << "x CSR Dijkstra), max stretch " << max_stretch
+                  << ", mean stretch " << sum_stretch / count << "\n";
+    }
+    return 0;
+}
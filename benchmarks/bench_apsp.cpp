@@ -0,0 +1,48 @@
+#include "sssp/apsp.hpp"
+#include <random>
+#include <iostream>
+#include <chrono>
+
+using namespace sssp;
+
+static Graph make_random_graph(int n, int m) {
+    Graph G;
+    for (int i = 0; i < n; ++i) G.add_vertex(i);
+    std::mt19937 rng(42);
+    std::uniform_int_distribution<int> vid(0, n - 1);
+    std::uniform_real_distribution<double> w(0.1, 10.0);
+    for (int i = 0; i < m; ++i) {
+        int u = vid(rng), v = vid(rng); if (u == v) v = (v + 1) % n;
+        G.add_edge(u, v, w(rng));
+    }
+    return G;
+}
+
+static double time_ms(const Graph& G, APSPMatrix& M, APSPMethod method) {
+    APSPOptions opts;
+    opts.method = method;
+    auto t0 = std::chrono::high_resolution_clock::now();
+    apsp(G, M, opts);
+    auto t1 = std::chrono::high_resolution_clock::now();
+    return std::chrono::duration<double, std::milli>(t1 - t0).count();
+}
+
+int main() {
+    const int n = 1000;
+    for (int degree : {2, 5, 10, 20, 50, 100}) {
+        Graph G = make_random_graph(n, n * degree);
+        APSPMatrix fw(n), rs(n);
+        double fw_ms = time_ms(G, fw, APSPMethod::FloydWarshall);
+        double rs_ms = time_ms(G, rs, APSPMethod::RepeatedSSSP);
+        std::size_t mismatches = 0;
+        for (std::size_t i = 0; i < std::size_t(n) * n; ++i) {
+            const float a = fw.data()[i], b = rs.data()[i];
+            if (a != b && std::abs(a - b) > 1e-4f * std::max(1.0f, b)) mismatches++;
+        }
+        const char* pick = choose_apsp_method(G) == APSPMethod::FloydWarshall ? "FloydWarshall" : "RepeatedSSSP";
+        std::cout << "n=" << n << " m=" << G.num_edges() << ": Floyd-Warshall " << fw_ms
+                  << " ms, repeated SSSP " << rs_ms << " ms, auto=" << pick
+                  << ", mismatches " << mismatches << "\n";
+    }
+    return 0;
+}
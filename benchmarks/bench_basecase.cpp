@@ -0,0 +1,104 @@
+// Counters come from the profiling hooks; this links the profiled library
+#include "sssp/api.hpp"
+#include <random>
+#include <iostream>
+#include <chrono>
+#include <cmath>
+
+using namespace sssp;
+
+static Graph make_random_graph(int n, int m) {
+    Graph G;
+    for (int i = 0; i < n; ++i) G.add_vertex(i);
+    std::mt19937 rng(42);
+    std::uniform_int_distribution<int> vid(0, n - 1);
+    std::uniform_real_distribution<double> w(0.1, 10.0);
+    for (int i = 0; i < m; ++i) {
+        int u = vid(rng), v = vid(rng);
+        if (u == v) v = (v + 1) % n;
+        G.add_edge(u, v, w(rng));
+    }
+    return G;
+}
+
+// Frontier of `size` vertices with tentative distances, as left by a Pull
+static std::vector<Vertex> seed_frontier(const Graph& G, std::size_t size, DistState& state) {
+    state.init(G.num_vertices());
+    std::mt19937 rng(7);
+    std::uniform_int_distribution<VertexId> vid(0, static_cast<VertexId>(G.num_vertices() - 1));
+    std::uniform_real_distribution<double> d(0.0, 5.0);
+    std::vector<Vertex> S;
+    for (std::size_t i = 0; i < size; ++i) {
+        const VertexId v = vid(rng);
+        if (state.get(v) != INFINITE_WEIGHT) continue;
+        state.set(v, d(rng));
+        S.push_back(Vertex(v));
+    }
+    return S;
+}
+
+struct Run {
+    double ms;
+    long long calls, pops;
+};
+
+template <typename F>
+static Run measure(F&& f) {
+    prof().basecase_calls = 0;
+    prof().basecase_pops = 0;
+    auto t0 = std::chrono::high_resolution_clock::now();
+    f();
+    auto t1 = std::chrono::high_resolution_clock::now();
+    return {std::chrono::duration<double, std::milli>(t1 - t0).count(), prof().basecase_calls.load(),
+            prof().basecase_pops.load()};
+}
+
+int main() {
+    const int n = 20000, m = 100000;
+    Graph G = make_random_graph(n, m);
+    const std::size_t k = G.num_vertices();   // k >= n: settle everything below B
+    const Weight B = 25.0;
+
+    for (std::size_t frontier : {8, 64, 512}) {
+        // Seeding only S.front(): the rest of S has to be picked up by further
+        // base cases, each re-settling what the earlier ones got wrong
+        DistState single;
+        auto S = seed_frontier(G, frontier, single);
+        Run front = measure([&] {
+            std::unordered_set<Vertex> done;
+            for (const auto& x : S) {
+                if (done.count(x)) continue;
+                for (const auto& u : BaseCase::run(G, B, x, single, k).U) done.insert(u);
+            }
+        });
+
+        DistState multi;
+        seed_frontier(G, frontier, multi);
+        Run bulk = measure([&] { BaseCase::run(G, B, S, multi, k); });
+
+        std::size_t mismatches = 0;
+        for (VertexId v = 0; v < static_cast<VertexId>(n); ++v) {
+            if (std::abs(single.get(v) - multi.get(v)) > 1e-9 && single.get(v) != multi.get(v)) mismatches++;
+        }
+        std::cout << "frontier=" << S.size() << " B=" << B << "\n"
+                  << "  front-only + reissue: " << front.ms << " ms, " << front.calls << " base cases, "
+                  << front.pops << " heap pops\n"
+                  << "  multi-source seed   : " << bulk.ms << " ms, " << bulk.calls << " base cases, "
+                  << bulk.pops << " heap pops\n"
+                  << "  distance mismatches : " << mismatches << "\n";
+    }
+
+    // Whole-solver counters for a multi-source frontier entering BMSSP
+    DistState state;
+    auto S = seed_frontier(G, 64, state);
+    prof().bmssp_calls = 0;
+    prof().pulls = 0;
+    prof().basecase_calls = 0;
+    prof().basecase_pops = 0;
+    const int l = BMSSP::top_level(n, G.get_t());
+    BMSSP::run(G, l, INFINITE_WEIGHT, S, state, G.get_k(), G.get_t());
+    std::cout << "BMSSP l=" << l << " frontier=" << S.size() << ": " << prof().bmssp_calls << " calls, "
+              << prof().pulls << " pulls, " << prof().basecase_calls << " base cases, " << prof().basecase_pops
+              << " heap pops\n";
+    return 0;
+}
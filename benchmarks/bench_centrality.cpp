@@ -0,0 +1,30 @@
+#include "sssp/centrality.hpp"
+#include "test_graphs.hpp"
+#include <iostream>
+#include <chrono>
+#include <cstdlib>
+
+using namespace sssp;
+
+// Usage: bench_centrality [side] [sample_sources] [threads]
+int main(int argc, char** argv) {
+    const int side = argc > 1 ? std::atoi(argv[1]) : 300;
+    CentralityOptions opts;
+    opts.sample_sources = argc > 2 ? std::strtoull(argv[2], nullptr, 10) : 64;
+    opts.num_threads = argc > 3 ? std::strtoull(argv[3], nullptr, 10) : 0;
+    Graph G = test::grid(side, 42);   // road-like input
+
+    auto t0 = std::chrono::high_resolution_clock::now();
+    auto bc = betweennessCentrality(G, opts);
+    auto t1 = std::chrono::high_resolution_clock::now();
+    auto cl = closenessCentrality(G, opts);
+    auto t2 = std::chrono::high_resolution_clock::now();
+
+    auto ms = [](auto a, auto b) { return std::chrono::duration<double, std::milli>(b - a).count(); };
+    const std::size_t top = std::max_element(bc.begin(), bc.end()) - bc.begin();
+    std::cout << "grid n=" << G.num_vertices() << " m=" << G.num_edges() << ", " << opts.sample_sources
+              << " sampled sources, " << resolve_threads(opts.num_threads) << " threads\n"
+              << "betweenness " << ms(t0, t1) << " ms (top vertex " << top << ")\n"
+              << "closeness+harmonic " << ms(t1, t2) << " ms (closeness[top]=" << cl.closeness[top] << ")\n";
+    return 0;
+}
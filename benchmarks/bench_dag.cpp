@@ -0,0 +1,66 @@
+#include "sssp/api.hpp"
+#include "sssp/dag.hpp"
+#include <random>
+#include <iostream>
+#include <chrono>
+#include <cmath>
+
+using namespace sssp;
+
+// Scheduling-style DAG: `layers` layers of `width` tasks, each with edges to
+// tasks up to three layers ahead
+static Graph make_layered_dag(int layers, int width, int out_degree) {
+    Graph G;
+    for (int i = 0; i < layers * width; ++i) G.add_vertex(i);
+    std::mt19937 rng(42);
+    std::uniform_int_distribution<int> col(0, width - 1), skip(1, 3);
+    std::uniform_real_distribution<double> w(0.1, 10.0);
+    for (int l = 0; l + 1 < layers; ++l) {
+        for (int c = 0; c < width; ++c) {
+            for (int d = 0; d < out_degree; ++d) {
+                const int to = std::min(layers - 1, l + skip(rng));
+                G.add_edge(l * width + c, to * width + col(rng), w(rng));
+            }
+        }
+    }
+    return G;
+}
+
+template <typename F>
+static double time_ms(int runs, F&& f) {
+    auto t0 = std::chrono::high_resolution_clock::now();
+    for (int i = 0; i < runs; ++i) f();
+    auto t1 = std::chrono::high_resolution_clock::now();
+    return std::chrono::duration<double, std::milli>(t1 - t0).count() / runs;
+}
+
+int main() {
+    const int runs = 5;
+    for (int layers : {100, 400}) {
+        const int width = 250, out_degree = 4;
+        Graph G = make_layered_dag(layers, width, out_degree);
+        const std::size_t n = G.num_vertices();
+        DistState dag, bmssp;
+
+        double order_ms = time_ms(1, [&] { (void)G.is_acyclic(); });   // first call builds the order
+        double dag_ms = time_ms(runs, [&] { DAGShortestPaths::run(G, Vertex(0), dag); });
+        double bmssp_ms = time_ms(runs, [&] {
+            bmssp.init(n);
+            bmssp.set(0, 0.0);
+            std::vector<Vertex> S = {Vertex(0)};
+            std::size_t t = G.get_t();
+            int l = BMSSP::top_level(n, t);
+            BMSSP::run(G, l, INFINITE_WEIGHT, S, bmssp, G.get_k(), t);
+        });
+
+        std::size_t mismatches = 0;
+        for (VertexId v = 0; v < n; ++v) {
+            if (std::abs(dag.get(v) - bmssp.get(v)) > 1e-9 && dag.get(v) != bmssp.get(v)) mismatches++;
+        }
+        std::cout << "layered DAG n=" << n << " m=" << G.num_edges()
+                  << ": topo order " << order_ms << " ms, DAG sweep " << dag_ms
+                  << " ms, BMSSP " << bmssp_ms << " ms (" << bmssp_ms / dag_ms << "x), mismatches "
+                  << mismatches << "\n";
+    }
+    return 0;
+}
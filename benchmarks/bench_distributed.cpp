@@ -0,0 +1,89 @@
+// Distributed delta-stepping over local processes against sequential Dijkstra.
+//
+//   bench_distributed [--procs N] [edges.txt]
+//
+// Without a file the input is a 400 x 400 road-like grid. With a file
+// ("u v w" or DIMACS lines, see GraphPartition::load_edge_list) every
+// process reads only its own partition. Runs 1, 2, 4, ... up to N processes
+// (default 4) over Unix sockets and reports the solve time on rank 0,
+// supersteps and cross-rank relaxations; the gathered distances are checked
+// against Dijkstra.
+#include "sssp/api.hpp"
+#include "sssp/distributed.hpp"
+#include "test_graphs.hpp"
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <string>
+
+using namespace sssp;
+
+int main(int argc, char** argv) {
+#ifdef _WIN32
+    (void)argc;
+    (void)argv;
+    std::cerr << "bench_distributed needs Unix sockets\n";
+    return 1;
+#else
+    std::size_t max_procs = 4;
+    std::string path;
+    for (int i = 1; i < argc; ++i) {
+        const std::string arg = argv[i];
+        if (arg == "--procs" && i + 1 < argc) {
+            max_procs = std::strtoul(argv[++i], nullptr, 10);
+        } else {
+            path = arg;
+        }
+    }
+
+    // The reference solve needs the whole graph in one process
+    Graph G;
+    if (path.empty()) {
+        G = test::grid(400, 1);
+    } else {
+        const GraphPartition whole = GraphPartition::load_edge_list(path, 0, 1);
+        for (VertexId v = 0; v < whole.num_vertices; ++v) G.add_vertex(v);
+        for (VertexId u = 0; u < whole.num_vertices; ++u) {
+            for (std::size_t e = whole.offsets[u]; e < whole.offsets[u + 1]; ++e) G.add_edge(u, whole.heads[e], whole.weights[e]);
+        }
+    }
+    const std::size_t n = G.num_vertices();
+    std::cout << (path.empty() ? std::string("grid 400x400") : path) << " n=" << n << " m=" << G.num_edges() << "\n"
+              << std::fixed << std::setprecision(1);
+
+    DistState reference;
+    auto t0 = std::chrono::steady_clock::now();
+    reference.init(n);
+    reference.set(0, 0.0);
+    BaseCase::run(G, INFINITE_WEIGHT, Vertex(0), reference, n);
+    std::cout << "  dijkstra=" << std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - t0).count()
+              << " ms\n";
+
+    for (std::size_t procs = 1; procs <= max_procs; procs *= 2) {
+        double ms = 0.0, remote = 0.0;
+        std::size_t supersteps = 0;
+        bool exact = false;
+        const bool ok = launch_local(procs, [&](Transport& t) {
+            const GraphPartition part = path.empty() ? GraphPartition::from_graph(G, t.rank(), t.size())
+                                                     : GraphPartition::load_edge_list(path, t.rank(), t.size());
+            t.all_reduce_min(0);   // start together
+            auto start = std::chrono::steady_clock::now();
+            const DistributedResult local = DistributedSSSP::run(part, t, 0);
+            const DistState state = DistributedSSSP::gather(part, t, local);
+            const double elapsed = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+            const double relaxations = t.all_reduce_sum(static_cast<double>(local.remote_relaxations));
+            if (t.rank() != 0) return;
+            ms = elapsed;
+            remote = relaxations;
+            supersteps = local.supersteps;
+            exact = true;
+            for (VertexId v = 0; v < n; ++v) exact = exact && state.get(v) == reference.get(v);
+        });
+        std::cout << "  procs=" << procs << " time=" << ms << " ms supersteps=" << supersteps
+                  << " remote_relaxations=" << std::setprecision(0) << remote << std::setprecision(1)
+                  << (!ok ? "  FAILED" : exact ? "" : "  MISMATCH") << "\n";
+    }
+    return 0;
+#endif
+}
@@ -0,0 +1,92 @@
+// MultiQueue SSSP against sequential Dijkstra, BMSSP and delta-stepping.
+//
+// Road-like input: a bidirected grid with random weights, whose diameter
+// grows with the side length, plus a random graph of the same size for
+// contrast. Reports times per thread count and queues per thread, and
+// checks every run against Dijkstra. The delta-stepping baseline is
+// DistributedSSSP on in-process ranks (one per thread), timed from
+// partitioning to the gathered result.
+#include "sssp/api.hpp"
+#include "sssp/distributed.hpp"
+#include "sssp/multiqueue.hpp"
+#include "test_graphs.hpp"
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <thread>
+
+using namespace sssp;
+
+static Graph make_random(int n, int m, unsigned seed) {
+    Graph G;
+    for (int i = 0; i < n; ++i) G.add_vertex(i);
+    std::mt19937 rng(seed);
+    std::uniform_int_distribution<int> vid(0, n - 1);
+    std::uniform_real_distribution<double> w(0.1, 10.0);
+    for (int i = 0; i < m; ++i) G.add_edge(vid(rng), vid(rng), w(rng));
+    return G;
+}
+
+template <class Fn>
+static double time_ms(Fn&& fn) {
+    auto t0 = std::chrono::steady_clock::now();
+    fn();
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - t0).count();
+}
+
+static void run(const char* name, const Graph& G) {
+    const std::size_t n = G.num_vertices();
+    std::cout << name << " n=" << n << " m=" << G.num_edges() << "\n" << std::fixed << std::setprecision(1);
+
+    DistState reference;
+    const double dijkstra_ms = time_ms([&] {
+        reference.init(n);
+        reference.set(0, 0.0);
+        BaseCase::run(G, INFINITE_WEIGHT, Vertex(0), reference, n);
+    });
+    DistState bmssp;
+    const double bmssp_ms = time_ms([&] { solveSSSP(G, Vertex(0), bmssp); });
+    std::cout << "  dijkstra=" << dijkstra_ms << " ms bmssp=" << bmssp_ms << " ms\n";
+
+    auto exact = [&](const DistState& state) {
+        if (state.dist.size() != n) return false;
+        for (VertexId v = 0; v < n; ++v) {
+            if (state.get(v) != reference.get(v)) return false;
+        }
+        return true;
+    };
+
+    const std::size_t hw = resolve_threads(0);
+    for (std::size_t threads = 1; threads <= 2 * hw; threads *= 2) {
+        DistState delta;
+        const double delta_ms = time_ms([&] {
+            launch_threads(threads, [&](Transport& t) {
+                const GraphPartition part = GraphPartition::from_graph(G, t.rank(), t.size());
+                const DistributedResult local = DistributedSSSP::run(part, t, 0);
+                DistState state = DistributedSSSP::gather(part, t, local);
+                if (t.rank() == 0) delta = std::move(state);
+            });
+        });
+        std::cout << "  delta-stepping threads=" << threads << " time=" << delta_ms
+                  << " ms speedup_vs_dijkstra=" << std::setprecision(2) << dijkstra_ms / delta_ms
+                  << std::setprecision(1) << (exact(delta) ? "" : "  MISMATCH") << "\n";
+        for (std::size_t c : {2u, 4u}) {
+            MultiQueueOptions opts;
+            opts.num_threads = threads;
+            opts.queues_per_thread = c;
+            DistState state;
+            const double ms = time_ms([&] { MultiQueueSSSP::run(G, Vertex(0), state, EdgeDirection::Outgoing, opts); });
+            std::cout << "  multiqueue threads=" << threads << " c=" << c << " time=" << ms
+                      << " ms speedup_vs_dijkstra=" << std::setprecision(2) << dijkstra_ms / ms
+                      << std::setprecision(1) << (exact(state) ? "" : "  MISMATCH") << "\n";
+        }
+    }
+}
+
+int main() {
+    std::cout << "hardware threads: " << resolve_threads(0) << "\n";
+    run("grid 500x500", test::grid(500, 1));
+    run("random", make_random(250000, 1000000, 2));
+    return 0;
+}
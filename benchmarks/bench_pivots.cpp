@@ -0,0 +1,139 @@
+// Pivot quality against runtime for each FindPivots rule.
+//
+// Runs the full recursion (Dijkstra cutoff 1) with k=8, t=4 on a uniform
+// and a skewed random graph, and reports the frontier reduction |P|/|S|,
+// rounds per call and early exits next to the solve and FindPivots times.
+// Then compares Sampled with Exact on the same frontiers: distance layers
+// [d0, d0 + delta) of the reference solve, bounded by B = d0 + 2 delta.
+// Links the profiled library for the counters.
+#include "sssp/api.hpp"
+#include "sssp/tuning.hpp"
+#include <chrono>
+#include <cmath>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <unordered_set>
+
+using namespace sssp;
+
+static Graph make_graph(int n, int m, bool skewed, unsigned seed) {
+    Graph G;
+    for (int i = 0; i < n; ++i) G.add_vertex(i);
+    std::mt19937 rng(seed);
+    std::uniform_int_distribution<int> vid(0, n - 1);
+    std::uniform_real_distribution<double> unit(0.0, 1.0);
+    std::uniform_real_distribution<double> w(0.1, 10.0);
+    for (int i = 0; i < m; ++i) {
+        // Skewed: sources concentrate on low ids, so a few hubs own most edges
+        int u = skewed ? (int)(n * std::pow(unit(rng), 4.0)) : vid(rng);
+        int v = vid(rng);
+        if (u == v) v = (v + 1) % n;
+        G.add_edge(u, v, w(rng));
+    }
+    return G;
+}
+
+// One FindPivots call on frontier S with the reference distances of S
+static FindPivots::Result pivots(const Graph& G, const DistState& reference, const std::unordered_set<Vertex>& S,
+                                 Weight B, std::size_t k, PivotRule rule, double& ms) {
+    DistState state;
+    state.init(G.num_vertices());
+    for (const auto& v : S) state.set(v.id(), reference.get(v.id()));
+    auto t0 = std::chrono::steady_clock::now();
+    auto res = FindPivots::execute(G, B, S, k, state, EdgeDirection::Outgoing, rule);
+    ms += std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - t0).count();
+    return res;
+}
+
+// Pivot quality of Sampled against Exact over a range of frontier layers
+static void compare_sampled(const Graph& G, const DistState& reference, std::size_t k) {
+    Weight max_d = 0.0;
+    for (VertexId v = 0; v < G.num_vertices(); ++v) {
+        if (reference.get(v) < INFINITE_WEIGHT) max_d = std::max(max_d, reference.get(v));
+    }
+    for (double delta : {0.05, 0.5}) {
+        std::size_t frontiers = 0, agree = 0, missed = 0, exact_P = 0, sampled_P = 0, frontier = 0;
+        std::size_t exact_rounds = 0, sampled_rounds = 0;
+        double exact_ms = 0.0, sampled_ms = 0.0;
+        for (Weight d0 = 0.0; d0 < max_d; d0 += max_d / 40.0) {
+            std::unordered_set<Vertex> S;
+            for (VertexId v = 0; v < G.num_vertices(); ++v) {
+                if (reference.get(v) >= d0 && reference.get(v) < d0 + delta) S.insert(Vertex(v));
+            }
+            if (S.size() < 2) continue;
+            const Weight B = d0 + 2.0 * delta;
+            double warm_ms = 0.0;   // so neither rule is charged for cold caches
+            pivots(G, reference, S, B, k, PivotRule::Exact, warm_ms);
+            const auto exact = pivots(G, reference, S, B, k, PivotRule::Exact, exact_ms);
+            const auto sampled = pivots(G, reference, S, B, k, PivotRule::Sampled, sampled_ms);
+            frontiers++;
+            frontier += S.size();
+            exact_P += exact.P.size();
+            sampled_P += sampled.P.size();
+            exact_rounds += exact.rounds;
+            sampled_rounds += sampled.rounds;
+            agree += exact.P == sampled.P;
+            // Sampled kept S although the exact pivots at least halve it
+            missed += sampled.P.size() == S.size() && 2 * exact.P.size() <= S.size();
+        }
+        const double f = (double)std::max<std::size_t>(frontiers, 1);
+        std::cout << "  sampled vs exact, layers of width " << delta << ": frontiers=" << frontiers
+                  << " mean|S|=" << frontier / f << std::setprecision(3)
+                  << " |P|/|S| exact=" << (double)exact_P / (double)std::max<std::size_t>(frontier, 1)
+                  << " sampled=" << (double)sampled_P / (double)std::max<std::size_t>(frontier, 1)
+                  << " same_P=" << agree << " missed_halvings=" << missed << std::setprecision(2)
+                  << " rounds exact=" << exact_rounds / f << " sampled=" << sampled_rounds / f
+                  << " ms exact=" << exact_ms << " sampled=" << sampled_ms << "\n";
+    }
+}
+
+int main() {
+    const int n = 20000, m = 80000;
+    for (bool skewed : {false, true}) {
+        const Graph G = make_graph(n, m, skewed, 7);
+        DistState reference;
+        reference.init(n);
+        BaseCase::run(G, INFINITE_WEIGHT, Vertex(0), reference, n);
+        std::cout << (skewed ? "skewed" : "uniform") << " n=" << n << " m=" << m << " (k=8 t=4)\n";
+        {
+            // Warm-up so the first rule is not charged for cold caches
+            BMSSPParams p;
+            p.k = 8;
+            p.t = 4;
+            p.dijkstra_cutoff = 1;
+            DistState state;
+            state.init(n);
+            state.set(0, 0.0);
+            BMSSP::run(G, p, INFINITE_WEIGHT, {Vertex(0)}, state);
+        }
+        for (PivotRule rule : {PivotRule::Exact, PivotRule::Projected, PivotRule::Sampled, PivotRule::SkipSmall}) {
+            BMSSPParams p;
+            p.k = 8;
+            p.t = 4;
+            p.dijkstra_cutoff = 1;
+            p.pivots = rule;
+            reset_profile();
+            DistState state;
+            state.init(n);
+            state.set(0, 0.0);
+            auto t0 = std::chrono::steady_clock::now();
+            BMSSP::run(G, p, INFINITE_WEIGHT, {Vertex(0)}, state);
+            const double ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - t0).count();
+
+            bool exact = true;
+            for (VertexId v = 0; v < (VertexId)n; ++v) exact = exact && state.get(v) == reference.get(v);
+            const double calls = (double)std::max<long long>(prof().pivot_calls.load(), 1);
+            std::cout << "  " << std::left << std::setw(10) << pivot_rule_name(rule) << std::right << std::fixed
+                      << std::setprecision(1) << " solve=" << ms << " ms findpivots="
+                      << prof().findpivots_ns.load() / 1e6 << " ms" << std::setprecision(2)
+                      << " calls=" << prof().pivot_calls.load()
+                      << " |P|/|S|=" << (double)prof().pivots.load() / (double)std::max<long long>(prof().pivot_frontier.load(), 1)
+                      << " rounds/call=" << prof().pivot_rounds.load() / calls
+                      << " early_exits=" << prof().pivot_early_exits.load()
+                      << (exact ? "" : "  MISMATCH") << "\n";
+        }
+        compare_sampled(G, reference, 8);
+    }
+    return 0;
+}
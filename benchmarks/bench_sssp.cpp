@@ -25,6 +25,7 @@ int main(){
     int n = 1000, m = 5000, runs = 5;
     Graph G = make_random_graph(n, m);
     Vertex s(0);
+    std::cout << "Dijkstra frame cutoff: " << BMSSP::resolve(default_params(), n).dijkstra_cutoff << "\n";
     auto t0 = std::chrono::high_resolution_clock::now();
     std::pair<std::unordered_map<Vertex, Weight>, std::unordered_map<Vertex, Vertex>> last;
     for (int i=0;i<runs;++i) {
@@ -34,5 +35,40 @@ int main(){
     double ms = std::chrono::duration_cast<std::chrono::milliseconds>(t1 - t0).count();
     std::cout << "Ran " << runs << " SSSP runs on n="<<n<<" m="<<m<<" in "<< ms <<" ms\n";
     std::cout << "dist[0]=" << last.first[s] << "\n";
+
+    // Same solve with the recursion forced everywhere
+    BMSSPParams recurse;
+    recurse.dijkstra_cutoff = 1;
+    t0 = std::chrono::high_resolution_clock::now();
+    for (int i=0;i<runs;++i) {
+        DistState state;
+        solveSSSP(G, s, state, recurse);
+    }
+    t1 = std::chrono::high_resolution_clock::now();
+    std::cout << "Recursion only: " << std::chrono::duration_cast<std::chrono::milliseconds>(t1 - t0).count() << " ms\n";
+
+    // Recursion with k and M adapted per frame
+    BMSSPParams adaptive;
+    adaptive.dijkstra_cutoff = 1;
+    FrameTuner tuner;
+    t0 = std::chrono::high_resolution_clock::now();
+    for (int i=0;i<runs;++i) {
+        DistState state;
+        state.init(n);
+        state.set(s.id(), 0.0);
+        BMSSP::run(G, adaptive, INFINITE_WEIGHT, {s}, state, tuner);
+    }
+    t1 = std::chrono::high_resolution_clock::now();
+    std::cout << "Recursion, adaptive k and M: " << std::chrono::duration_cast<std::chrono::milliseconds>(t1 - t0).count() << " ms\n";
+    const auto& levels = tuner.levels();
+    for (std::size_t l = 1; l < levels.size(); ++l) {
+        const auto& lv = levels[l];
+        if (lv.frames == 0) continue;
+        std::cout << "  level " << l << ": frames=" << lv.frames << " k=" << lv.k << " M=" << lv.M
+                  << " pivot_early_exits=" << lv.pivot_early_exits
+                  << " avg_W/S=" << lv.w_per_s / lv.frames
+                  << " avg_pull=" << (lv.pulls ? (double)lv.pulled / lv.pulls : 0.0)
+                  << " partial_subcalls=" << lv.partial_subcalls << "\n";
+    }
     return 0;
 }
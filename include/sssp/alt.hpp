@@ -0,0 +1,332 @@
+#ifndef SSSP_ALT_HPP
+#define SSSP_ALT_HPP
+
+#include "sssp/types.hpp"
+#include "sssp/graph.hpp"
+#include "sssp/api.hpp"
+#include "sssp/binary_heap.hpp"
+#include <vector>
+#include <string>
+#include <fstream>
+#include <random>
+#include <cstdint>
+#include <cfloat>
+#include <cstring>
+#include <limits>
+#include <algorithm>
+#include <stdexcept>
+
+namespace sssp {
+
+struct ALTResult {
+    Weight distance;
+    std::vector<Vertex> path;   // source ... target, empty if unreachable
+    std::size_t settled;        // vertices extracted from the A* queue
+};
+
+/**
+ * @brief ALT (A*, Landmarks, Triangle inequality) point-to-point engine
+ *
+ * Preprocessing picks L landmarks and stores, for every vertex v and
+ * landmark l, the distances d(l, v) and d(v, l), computed with the batch
+ * solver from l (solveSSSP) and to l (solveReverseSSSP). By the triangle
+ * inequality
+ *
+ *     d(v, t) >= d(l, t) - d(l, v)   and   d(v, t) >= d(v, l) - d(t, l),
+ *
+ * so the maximum over all landmarks is a consistent A* potential towards t.
+ *
+ * Both tables are stored vertex-major (entry v * L + i), so evaluating a
+ * bound reads contiguous runs of L values for v and for t. Entries are
+ * floats, half the memory and cache traffic of doubles; each difference is
+ * shrunk by the float rounding error of its two entries, so the bound stays
+ * a lower bound, and queries re-open vertices, so results remain exact.
+ */
+class ALT {
+public:
+    enum class LandmarkStrategy {
+        Farthest,   // greedily maximise the distance to already chosen landmarks
+        Avoid       // Goldberg-Werneck: descend into the worst-covered subtree
+    };
+
+    /**
+     * @brief Select landmarks and compute the distance tables
+     *
+     * @param G Graph with dense vertex ids in [0, n)
+     * @param num_landmarks Requested number of landmarks (capped at n)
+     * @param strategy Landmark selection strategy
+     * @param seed Seed for the random roots used by the selection
+     */
+    static ALT preprocess(const Graph& G, std::size_t num_landmarks,
+                          LandmarkStrategy strategy = LandmarkStrategy::Avoid,
+                          std::uint64_t seed = 42) {
+        ALT alt;
+        alt.n_ = G.num_vertices();
+        alt.m_ = G.num_edges();
+        const std::size_t n = alt.n_;
+        if (n == 0) return alt;
+        num_landmarks = std::min(num_landmarks, n);
+
+        std::vector<std::vector<Weight>> from_cols, to_cols;  // one column per landmark
+        std::vector<char> is_landmark(n, 0);
+        std::mt19937_64 rng(seed);
+        DistState fwd, bwd;
+
+        auto add_landmark = [&](VertexId l) {
+            solveSSSP(G, Vertex(l), fwd);
+            solveReverseSSSP(G, Vertex(l), bwd);
+            from_cols.push_back(fwd.dist);
+            to_cols.push_back(bwd.dist);
+            alt.landmarks_.push_back(Vertex(l));
+            is_landmark[l] = 1;
+        };
+
+        // Farthest choice: maximise min_l (d(l, v) + d(v, l)); unreached
+        // vertices score infinity so new components get covered first.
+        auto farthest = [&]() {
+            VertexId best = INVALID_VERTEX;
+            Weight best_score = -1.0;
+            for (VertexId v = 0; v < n; ++v) {
+                if (is_landmark[v]) continue;
+                Weight score = INFINITE_WEIGHT;
+                for (std::size_t i = 0; i < from_cols.size(); ++i) {
+                    score = std::min(score, from_cols[i][v] + to_cols[i][v]);
+                }
+                if (score > best_score) { best_score = score; best = v; }
+            }
+            return best;
+        };
+
+        while (alt.landmarks_.size() < num_landmarks) {
+            VertexId next = INVALID_VERTEX;
+            if (alt.landmarks_.empty()) {
+                // Start from the vertex farthest from a random root
+                VertexId r = static_cast<VertexId>(rng() % n);
+                solveSSSP(G, Vertex(r), fwd);
+                Weight best = -1.0;
+                for (VertexId v = 0; v < n; ++v) {
+                    if (fwd.dist[v] < INFINITE_WEIGHT && fwd.dist[v] > best) { best = fwd.dist[v]; next = v; }
+                }
+            } else if (strategy == LandmarkStrategy::Avoid) {
+                next = avoid_pick(G, static_cast<VertexId>(rng() % n), from_cols, to_cols, is_landmark, fwd);
+            }
+            if (next == INVALID_VERTEX || is_landmark[next]) next = farthest();
+            if (next == INVALID_VERTEX) break;
+            add_landmark(next);
+        }
+
+        const std::size_t L = alt.landmarks_.size();
+        alt.from_landmark_.assign(n * L, INFINITE_TABLE);
+        alt.to_landmark_.assign(n * L, INFINITE_TABLE);
+        for (std::size_t i = 0; i < L; ++i) {
+            for (VertexId v = 0; v < n; ++v) {
+                alt.from_landmark_[v * L + i] = static_cast<float>(from_cols[i][v]);
+                alt.to_landmark_[v * L + i] = static_cast<float>(to_cols[i][v]);
+            }
+        }
+        return alt;
+    }
+
+    /**
+     * @brief Max-over-landmarks lower bound on d(v, t)
+     *
+     * Landmarks that do not reach (or are not reached by) both v and t
+     * carry no information and are skipped.
+     */
+    Weight lower_bound(VertexId v, VertexId t) const {
+        const std::size_t L = landmarks_.size();
+        const float* fv = &from_landmark_[v * L];
+        const float* ft = &from_landmark_[t * L];
+        const float* tv = &to_landmark_[v * L];
+        const float* tt = &to_landmark_[t * L];
+        Weight h = 0.0;
+        for (std::size_t i = 0; i < L; ++i) {
+            if (ft[i] < INFINITE_TABLE && fv[i] < INFINITE_TABLE) h = std::max(h, below(ft[i], fv[i]));
+            if (tv[i] < INFINITE_TABLE && tt[i] < INFINITE_TABLE) h = std::max(h, below(tv[i], tt[i]));
+        }
+        return h;
+    }
+
+    /**
+     * @brief A* query from source to target using the landmark potential
+     *
+     * @param G The graph the index was built for
+     */
+    ALTResult query(const Graph& G, const Vertex& source, const Vertex& target) const {
+        ALTResult res{INFINITE_WEIGHT, {}, 0};
+        if (!G.has_vertex(source) || !G.has_vertex(target)) return res;
+        if (G.num_vertices() != n_) {
+            throw std::invalid_argument("ALT index was built for a different graph");
+        }
+
+        std::vector<Weight> dist(n_, INFINITE_WEIGHT);
+        std::vector<VertexId> pred(n_, INVALID_VERTEX);
+        const VertexId t = target.id();
+        BinaryHeap H;
+        dist[source.id()] = 0.0;
+        H.insert(source, lower_bound(source.id(), t));
+
+        while (!H.empty()) {
+            auto [u, fu] = H.extract_min();
+            res.settled++;
+            if (u == target) break;
+            const Weight du = dist[u.id()];
+            for (const auto& e : G.get_outgoing_edges(u)) {
+                const VertexId v = e.destination().id();
+                const Weight alt = du + e.weight();
+                if (alt < dist[v]) {
+                    dist[v] = alt;
+                    pred[v] = u.id();
+                    H.insert(e.destination(), alt + lower_bound(v, t));
+                }
+            }
+        }
+
+        if (dist[t] == INFINITE_WEIGHT) return res;
+        res.distance = dist[t];
+        for (VertexId v = t; v != INVALID_VERTEX; v = pred[v]) res.path.push_back(Vertex(v));
+        std::reverse(res.path.begin(), res.path.end());
+        return res;
+    }
+
+    /**
+     * @brief Persist the index next to its graph in a flat binary format
+     */
+    void save(const std::string& path) const {
+        std::ofstream out(path, std::ios::binary);
+        if (!out) throw std::runtime_error("Cannot open ALT index file for writing: " + path);
+        const std::uint64_t header[4] = {FORMAT_VERSION, n_, m_, landmarks_.size()};
+        out.write(MAGIC, sizeof(MAGIC));
+        out.write(reinterpret_cast<const char*>(header), sizeof(header));
+        for (const auto& l : landmarks_) {
+            const std::uint64_t id = l.id();
+            out.write(reinterpret_cast<const char*>(&id), sizeof(id));
+        }
+        out.write(reinterpret_cast<const char*>(from_landmark_.data()), from_landmark_.size() * sizeof(float));
+        out.write(reinterpret_cast<const char*>(to_landmark_.data()), to_landmark_.size() * sizeof(float));
+        if (!out) throw std::runtime_error("Failed to write ALT index: " + path);
+    }
+
+    /**
+     * @brief Load an index saved with save() and check it matches G
+     */
+    static ALT load(const std::string& path, const Graph& G) {
+        std::ifstream in(path, std::ios::binary);
+        if (!in) throw std::runtime_error("Cannot open ALT index file: " + path);
+        char magic[sizeof(MAGIC)];
+        std::uint64_t header[4];
+        in.read(magic, sizeof(magic));
+        in.read(reinterpret_cast<char*>(header), sizeof(header));
+        if (!in || std::memcmp(magic, MAGIC, sizeof(MAGIC)) != 0 || header[0] != FORMAT_VERSION) {
+            throw std::runtime_error("Not an ALT index file: " + path);
+        }
+        if (header[1] != G.num_vertices() || header[2] != G.num_edges()) {
+            throw std::runtime_error("ALT index does not match the graph: " + path);
+        }
+        ALT alt;
+        alt.n_ = header[1];
+        alt.m_ = header[2];
+        const std::size_t L = header[3];
+        for (std::size_t i = 0; i < L; ++i) {
+            std::uint64_t id = 0;
+            in.read(reinterpret_cast<char*>(&id), sizeof(id));
+            alt.landmarks_.push_back(Vertex(id));
+        }
+        alt.from_landmark_.resize(alt.n_ * L);
+        alt.to_landmark_.resize(alt.n_ * L);
+        in.read(reinterpret_cast<char*>(alt.from_landmark_.data()), alt.from_landmark_.size() * sizeof(float));
+        in.read(reinterpret_cast<char*>(alt.to_landmark_.data()), alt.to_landmark_.size() * sizeof(float));
+        if (!in) throw std::runtime_error("Truncated ALT index file: " + path);
+        return alt;
+    }
+
+    [[nodiscard]] std::size_t num_landmarks() const noexcept { return landmarks_.size(); }
+    [[nodiscard]] const std::vector<Vertex>& landmarks() const noexcept { return landmarks_; }
+    [[nodiscard]] std::size_t num_vertices() const noexcept { return n_; }
+
+private:
+    static constexpr char MAGIC[8] = {'S', 'S', 'S', 'P', 'A', 'L', 'T', '\0'};
+    static constexpr std::uint64_t FORMAT_VERSION = 2;   // 2: float tables
+    static constexpr float INFINITE_TABLE = std::numeric_limits<float>::infinity();
+
+    std::size_t n_ = 0;
+    std::size_t m_ = 0;
+    std::vector<Vertex> landmarks_;
+    std::vector<float> from_landmark_;  // d(l, v) at v * L + i
+    std::vector<float> to_landmark_;    // d(v, l) at v * L + i
+
+    /**
+     * @brief a - b for rounded table entries, lowered by their rounding error
+     *
+     * Each entry is within FLT_EPSILON / 2 of the exact distance relative to
+     * its magnitude, so subtracting FLT_EPSILON * (a + b) never overshoots.
+     */
+    static Weight below(float a, float b) {
+        return static_cast<Weight>(a) - static_cast<Weight>(b) - FLT_EPSILON * (static_cast<Weight>(a) + static_cast<Weight>(b));
+    }
+
+    /**
+     * @brief Avoid heuristic: pick a leaf of the worst-covered subtree
+     *
+     * Builds the shortest-path tree from r, weighs every vertex by the gap
+     * d(r, v) - LB(r, v) of the current landmark bounds, zeroes subtrees
+     * that already contain a landmark, and walks from r into the heaviest
+     * child until reaching a leaf.
+     */
+    static VertexId avoid_pick(const Graph& G, VertexId r,
+                               const std::vector<std::vector<Weight>>& from_cols,
+                               const std::vector<std::vector<Weight>>& to_cols,
+                               const std::vector<char>& is_landmark,
+                               DistState& tree) {
+        const std::size_t n = G.num_vertices();
+        solveSSSP(G, Vertex(r), tree);
+
+        std::vector<std::vector<VertexId>> children(n);
+        for (VertexId v = 0; v < n; ++v) {
+            if (v != r && tree.has_pred(v) && tree.dist[v] < INFINITE_WEIGHT) children[tree.get_pred(v)].push_back(v);
+        }
+
+        // Preorder from r; sizes are then accumulated in reverse preorder
+        std::vector<VertexId> order;
+        std::vector<VertexId> stack = {r};
+        while (!stack.empty()) {
+            VertexId v = stack.back();
+            stack.pop_back();
+            order.push_back(v);
+            for (VertexId c : children[v]) stack.push_back(c);
+        }
+
+        std::vector<Weight> size(n, 0.0);
+        std::vector<char> covered(n, 0);
+        for (auto it = order.rbegin(); it != order.rend(); ++it) {
+            const VertexId v = *it;
+            Weight lb = 0.0;
+            for (std::size_t i = 0; i < from_cols.size(); ++i) {
+                if (from_cols[i][v] < INFINITE_WEIGHT && from_cols[i][r] < INFINITE_WEIGHT) lb = std::max(lb, from_cols[i][v] - from_cols[i][r]);
+                if (to_cols[i][r] < INFINITE_WEIGHT && to_cols[i][v] < INFINITE_WEIGHT) lb = std::max(lb, to_cols[i][r] - to_cols[i][v]);
+            }
+            covered[v] = is_landmark[v];
+            size[v] = tree.dist[v] - lb;
+            for (VertexId c : children[v]) {
+                covered[v] |= covered[c];
+                size[v] += size[c];
+            }
+            if (covered[v]) size[v] = 0.0;
+        }
+
+        if (size[r] <= 0.0) return INVALID_VERTEX;
+        VertexId v = r;
+        while (true) {
+            VertexId best = INVALID_VERTEX;
+            for (VertexId c : children[v]) {
+                if (size[c] > 0.0 && (best == INVALID_VERTEX || size[c] > size[best])) best = c;
+            }
+            if (best == INVALID_VERTEX) return v;
+            v = best;
+        }
+    }
+};
+
+} // namespace sssp
+
+#endif // SSSP_ALT_HPP
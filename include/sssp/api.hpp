@@ -4,25 +4,173 @@
 #include "sssp/types.hpp"
 #include "sssp/graph.hpp"
 #include "sssp/bmssp.hpp"
+#include "sssp/tuning.hpp"
+#include "sssp/bfs.hpp"
+#include "sssp/dag.hpp"
+#include "sssp/approximate.hpp"
 #include <unordered_map>
 #include <vector>
 #include <utility>
 #include <cmath>
+#include <stdexcept>
 
 namespace sssp {
 
+namespace detail {
+
+// Acyclic and uniform-weight graphs need no recursion; true if one of those
+// fast paths filled state
+inline bool solve_special_case(const Graph& G, const Vertex& source, DistState& state, EdgeDirection dir) {
+    if (G.is_acyclic()) {
+        // One relaxation sweep in topological order
+        DAGShortestPaths::run(G, source, state, dir);
+        return true;
+    }
+    if (G.has_uniform_weights()) {
+        // All edges share one weight: shortest paths are BFS levels
+        DirectionOptimizingBFS::run(G, source, G.uniform_weight(), state, dir);
+        return true;
+    }
+    return false;
+}
+
+} // namespace detail
+
+// Runs the batch solver from source into a caller-owned DistState (dense,
+// indexed by vertex id). Unreachable vertices keep INFINITE_WEIGHT.
+// dir = Incoming searches the reverse graph; see solveReverseSSSP.
+// params overrides k, t, l, the block size and the Dijkstra cutoff; zero
+// fields are derived from n (see BMSSPParams and tuning.hpp). Any override
+// runs BMSSP; only all-derived params take the DAG and BFS fast paths.
+inline void solveSSSP(const Graph& G, const Vertex& source, DistState& state, const BMSSPParams& params,
+                      EdgeDirection dir = EdgeDirection::Outgoing) {
+    state.init(G.num_vertices());
+    if (!G.has_vertex(source)) return;
+    if (params.derived() && detail::solve_special_case(G, source, state, dir)) return;
+    state.set(source.id(), 0.0);
+    std::vector<Vertex> S = {source};
+    BMSSP::run(G, params, std::numeric_limits<Weight>::infinity(), S, state, dir);
+}
+
+// Default solve: the DAG and BFS fast paths where they apply, otherwise
+// BMSSP with default_params() (the tuning file's `default` entry, if set).
+inline void solveSSSP(const Graph& G, const Vertex& source, DistState& state,
+                      EdgeDirection dir = EdgeDirection::Outgoing) {
+    const BMSSPParams& params = default_params();
+    if (!params.derived() && G.has_vertex(source)) {
+        state.init(G.num_vertices());
+        if (detail::solve_special_case(G, source, state, dir)) return;
+    }
+    solveSSSP(G, source, state, params, dir);
+}
+
+// Approximate mode: distances within a factor (1 + epsilon) of the exact
+// ones, each the length of the pred-tree path. epsilon <= 0 runs the exact
+// solver. Repeated calls on one graph should reuse an ApproximateSSSP.
+inline void solveSSSP(const Graph& G, const Vertex& source, DistState& state, double epsilon,
+                      EdgeDirection dir = EdgeDirection::Outgoing) {
+    if (epsilon <= 0.0) {
+        solveSSSP(G, source, state, dir);
+        return;
+    }
+    ApproximateSSSP(G, epsilon, dir).run(source, state);
+}
+
+// Multi-source solve: one search from all sources at once. Every vertex gets
+// the distance to its nearest source, min_i initial_offsets[i] + d(sources[i], v)
+// (offsets default to 0), and owner[v] = the index i of that source, i.e. a
+// graph Voronoi partition. owner[v] is INVALID_VERTEX if no source reaches v.
+// The sources seed one top-level BMSSP call (the multi-source frontier S of
+// Algorithm 3); owners are read off the resulting pred forest, so every cell
+// is connected through its tree edges and ties follow the forest.
+inline void solveMultiSource(const Graph& G, const std::vector<Vertex>& sources,
+                             const std::vector<Weight>& initial_offsets, DistState& state,
+                             std::vector<VertexId>& owner, EdgeDirection dir = EdgeDirection::Outgoing) {
+    const std::size_t n = G.num_vertices();
+    if (!initial_offsets.empty() && initial_offsets.size() != sources.size()) {
+        throw std::invalid_argument("initial_offsets must be empty or match sources");
+    }
+    state.init(n);
+    owner.assign(n, INVALID_VERTEX);
+
+    // Seed every distinct source vertex with its best offset
+    std::vector<Vertex> S;
+    for (std::size_t i = 0; i < sources.size(); ++i) {
+        const VertexId s = sources[i].id();
+        if (!G.has_vertex(sources[i])) throw std::invalid_argument("Source is not a vertex of the graph");
+        const Weight offset = initial_offsets.empty() ? 0.0 : initial_offsets[i];
+        if (owner[s] == INVALID_VERTEX) S.push_back(sources[i]);
+        if (owner[s] == INVALID_VERTEX || offset < state.get(s)) {
+            state.set(s, offset);
+            owner[s] = i;
+        }
+    }
+    if (S.empty()) return;
+
+    BMSSP::run(G, default_params(), INFINITE_WEIGHT, S, state, dir);
+
+    // Roots of the forest are sources that kept their offset; a source
+    // reached more cheaply from another one hangs below it
+    for (const auto& s : S) {
+        if (state.has_pred(s.id())) owner[s.id()] = INVALID_VERTEX;
+    }
+    std::vector<VertexId> path;
+    for (VertexId v = 0; v < n; ++v) {
+        if (owner[v] != INVALID_VERTEX || state.get(v) == INFINITE_WEIGHT) continue;
+        VertexId u = v;
+        while (owner[u] == INVALID_VERTEX && state.has_pred(u) && path.size() < n) {
+            path.push_back(u);
+            u = state.get_pred(u);
+        }
+        if (owner[u] == INVALID_VERTEX) throw std::logic_error("pred forest does not lead to a source");
+        for (VertexId x : path) owner[x] = owner[u];
+        path.clear();
+    }
+}
+
+struct MultiSourceResult {
+    DistState state;               // dist to the nearest source, pred forest
+    std::vector<VertexId> owner;   // index into sources, INVALID_VERTEX if unreached
+};
+
+inline MultiSourceResult solveMultiSource(const Graph& G, const std::vector<Vertex>& sources,
+                                          const std::vector<Weight>& initial_offsets = {},
+                                          EdgeDirection dir = EdgeDirection::Outgoing) {
+    MultiSourceResult res;
+    solveMultiSource(G, sources, initial_offsets, res.state, res.owner, dir);
+    return res;
+}
+
+// Single-target variant: distances from every vertex to target, computed by
+// the batch solver over incoming edges (no reversed graph copy). state.pred
+// holds successors: get_pred(v) is the next hop from v towards target.
+inline void solveReverseSSSP(const Graph& G, const Vertex& target, DistState& state) {
+    solveSSSP(G, target, state, EdgeDirection::Incoming);
+}
+
+// Map-returning form of solveReverseSSSP: (distance to target, successor).
+inline std::pair<std::unordered_map<Vertex, Weight>, std::unordered_map<Vertex, Vertex>>
+solveReverseSSSP(const Graph& G, const Vertex& target) {
+    std::unordered_map<Vertex, Weight> out_dist;
+    std::unordered_map<Vertex, Vertex> out_succ;
+    if (!G.has_vertex(target)) return {out_dist, out_succ};
+    DistState state;
+    solveReverseSSSP(G, target, state);
+    for (const auto& v : G.vertices()) {
+        Weight d = state.get(v.id());
+        if (d < INFINITE_WEIGHT) out_dist[v] = d;
+        if (state.has_pred(v.id())) out_succ[v] = Vertex(state.get_pred(v.id()));
+    }
+    return {out_dist, out_succ};
+}
+
 inline std::pair<std::unordered_map<Vertex, Weight>, std::unordered_map<Vertex, Vertex>>
 solveSSSP(const Graph& G, const Vertex& source) {
     std::unordered_map<Vertex, Weight> out_dist;
     std::unordered_map<Vertex, Vertex> out_pred;
     if (!G.has_vertex(source)) return {out_dist, out_pred};
-    DistState state; state.init(G.num_vertices());
-    state.set(source.id(), 0.0);
-    std::vector<Vertex> S = {source};
-    std::size_t k = G.get_k();
-    std::size_t t = G.get_t();
-    int l = (int)((std::log((double)std::max<std::size_t>(G.num_vertices(),1)))/ (double)std::max<std::size_t>(t,1)) + 1;
-    BMSSP::run(G, l, std::numeric_limits<Weight>::infinity(), S, state, k, t);
+    DistState state;
+    solveSSSP(G, source, state);
     for (const auto& v : G.vertices()) {
         Weight d = state.get(v.id());
         if (d < INFINITE_WEIGHT) out_dist[v] = d;
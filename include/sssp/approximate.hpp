@@ -0,0 +1,160 @@
+#ifndef SSSP_APPROXIMATE_HPP
+#define SSSP_APPROXIMATE_HPP
+
+#include "sssp/types.hpp"
+#include "sssp/graph.hpp"
+#include <vector>
+#include <queue>
+#include <cmath>
+#include <cstdint>
+#include <utility>
+#include <functional>
+#include <algorithm>
+#include <stdexcept>
+
+namespace sssp {
+
+/**
+ * @brief (1+epsilon)-approximate SSSP over weights rounded to powers of (1+epsilon)
+ *
+ * Every positive weight w is rounded up to w' = w_min (1+epsilon)^c, the
+ * smallest such power not below w, so w <= w' < (1+epsilon) w and the
+ * graph has only K = O(log_{1+epsilon}(w_max / w_min)) distinct weights
+ * (zero weights form one more class). Shortest paths on the rounded graph
+ * are then found exactly with one FIFO queue per weight class: vertices are
+ * settled in non-decreasing distance, so the keys pushed into each queue
+ * are already sorted, and only the K queue heads need a priority queue.
+ * Relaxations cost O(1) and extractions O(log K) instead of O(log n).
+ *
+ * The reported dist is the true length of the pred-tree path, accumulated
+ * with the original weights as vertices are settled. It is a real path
+ * length, so d(v) <= dist(v) <= d'(v) < (1+epsilon) d(v).
+ *
+ * Build the engine once per (graph, epsilon) and reuse it for many sources;
+ * it keeps a flat copy of G's adjacency, so G must not change afterwards.
+ * Vertex ids are assumed dense in [0, n).
+ */
+class ApproximateSSSP {
+public:
+    ApproximateSSSP(const Graph& G, double epsilon, EdgeDirection dir = EdgeDirection::Outgoing)
+        : n_(G.num_vertices()), epsilon_(epsilon) {
+        if (!(epsilon > 0.0)) throw std::invalid_argument("epsilon must be positive");
+
+        Weight w_min = INFINITE_WEIGHT;
+        for (const auto& e : G.edges()) {
+            if (e.weight() > 0.0) w_min = std::min(w_min, e.weight());
+        }
+        const double log_base = std::log1p(epsilon);
+
+        offsets_.assign(n_ + 1, 0);
+        heads_.reserve(G.num_edges());
+        weights_.reserve(G.num_edges());
+        classes_.reserve(G.num_edges());
+        for (VertexId u = 0; u < n_; ++u) {
+            for (const auto& e : G.get_edges(Vertex(u), dir)) {
+                heads_.push_back(Graph::far_end(e, dir).id());
+                weights_.push_back(e.weight());
+                classes_.push_back(e.weight() > 0.0 ? rounding_class(e.weight(), w_min, log_base) : 0);
+            }
+            offsets_[u + 1] = heads_.size();
+        }
+
+        // Class 0 holds zero weights; class c + 1 holds w_min (1+epsilon)^c
+        std::uint32_t max_class = 0;
+        for (auto c : classes_) max_class = std::max(max_class, c);
+        class_weight_.assign(max_class + 1, 0.0);
+        for (std::uint32_t c = 1; c <= max_class; ++c) {
+            class_weight_[c] = w_min * std::pow(1.0 + epsilon, static_cast<double>(c - 1));
+        }
+        for (std::size_t a = 0; a < weights_.size(); ++a) {
+            // Guard against pow/log rounding: the class weight must not be below w
+            while (classes_[a] > 0 && class_weight_[classes_[a]] < weights_[a]) {
+                if (++classes_[a] == class_weight_.size()) {
+                    class_weight_.push_back(class_weight_.back() * (1.0 + epsilon));
+                }
+            }
+        }
+        queues_.resize(class_weight_.size());
+        pred_arc_.assign(n_, 0);
+    }
+
+    /**
+     * @brief Approximate distances and a pred tree from source
+     */
+    void run(const Vertex& source, DistState& state) {
+        state.init(n_);
+        if (source.id() >= n_) return;
+        rounded_.assign(n_, INFINITE_WEIGHT);
+        settled_.assign(n_, 0);
+        for (auto& q : queues_) q.clear();
+        heads_pq_ = {};
+
+        const VertexId s = source.id();
+        rounded_[s] = 0.0;
+        state.set(s, 0.0);
+        settle(s, state);
+
+        while (!heads_pq_.empty()) {
+            const std::uint32_t c = heads_pq_.top().second;
+            heads_pq_.pop();
+            auto& q = queues_[c];
+            const auto [v, key] = q.entries[q.head++];
+            if (q.head < q.entries.size()) heads_pq_.push({q.entries[q.head].second, c});
+            if (settled_[v] || key > rounded_[v]) continue;   // stale entry
+            state.set(v, state.get(state.get_pred(v)) + weights_[pred_arc_[v]]);
+            settle(v, state);
+        }
+    }
+
+    [[nodiscard]] double epsilon() const noexcept { return epsilon_; }
+    [[nodiscard]] std::size_t num_weight_classes() const noexcept { return class_weight_.size(); }
+
+private:
+    struct ClassQueue {
+        std::vector<std::pair<VertexId, Weight>> entries;   // keys non-decreasing
+        std::size_t head = 0;
+        void clear() { entries.clear(); head = 0; }
+    };
+    using HeadEntry = std::pair<Weight, std::uint32_t>;   // (key of queue head, class)
+
+    std::size_t n_;
+    double epsilon_;
+    std::vector<std::size_t> offsets_;
+    std::vector<VertexId> heads_;
+    std::vector<Weight> weights_;                   // original weights
+    std::vector<std::uint32_t> classes_;
+    std::vector<Weight> class_weight_;              // rounded weight per class
+    std::vector<Weight> rounded_;                   // distances in the rounded graph
+    std::vector<std::size_t> pred_arc_;             // arc that set rounded_[v]
+    std::vector<char> settled_;
+    std::vector<ClassQueue> queues_;
+    std::priority_queue<HeadEntry, std::vector<HeadEntry>, std::greater<HeadEntry>> heads_pq_;
+
+    static std::uint32_t rounding_class(Weight w, Weight w_min, double log_base) {
+        const double c = std::ceil(std::log(w / w_min) / log_base - 1e-12);
+        return static_cast<std::uint32_t>(std::max(0.0, c)) + 1;
+    }
+
+    void settle(VertexId u, DistState& state) {
+        settled_[u] = 1;
+        const Weight du = rounded_[u];
+        for (std::size_t a = offsets_[u]; a < offsets_[u + 1]; ++a) {
+            const VertexId v = heads_[a];
+            if (settled_[v]) continue;
+            const std::uint32_t c = classes_[a];
+            const Weight alt = du + class_weight_[c];
+            if (alt < rounded_[v]) {
+                rounded_[v] = alt;
+                pred_arc_[v] = a;
+                state.set_pred(v, u);
+                auto& q = queues_[c];
+                if (q.head == q.entries.size()) heads_pq_.push({alt, c});   // queue was empty
+                q.entries.push_back({v, alt});
+            }
+        }
+    }
+};
+
+} // namespace sssp
+
+#endif // SSSP_APPROXIMATE_HPP
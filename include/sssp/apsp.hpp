@@ -0,0 +1,296 @@
+#ifndef SSSP_APSP_HPP
+#define SSSP_APSP_HPP
+
+#include "sssp/types.hpp"
+#include "sssp/graph.hpp"
+#include "sssp/distance_matrix.hpp"
+#include "sssp/parallel.hpp"
+#include <vector>
+#include <string>
+#include <limits>
+#include <algorithm>
+#include <stdexcept>
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+namespace sssp {
+
+enum class APSPMethod {
+    Auto,            // choose from n and density
+    FloydWarshall,   // blocked min-plus Floyd-Warshall, O(n^3)
+    RepeatedSSSP     // one Dijkstra per source, O(n m log n)
+};
+
+struct APSPOptions {
+    APSPMethod method = APSPMethod::Auto;
+    std::size_t num_threads = 0;   // 0 = hardware concurrency
+};
+
+/**
+ * @brief Dense row-major n x n float distance matrix
+ *
+ * Owns its storage, either on the heap or as a shared file mapping
+ * (map_file) so matrices larger than RAM can be paged by the OS and the
+ * result outlives the process. Move-only.
+ */
+class APSPMatrix {
+public:
+    APSPMatrix() = default;
+    explicit APSPMatrix(std::size_t n) : n_(n), heap_(n * n), data_(heap_.data()) {}
+
+    /**
+     * @brief Matrix backed by a memory-mapped file of n * n floats
+     *
+     * The file is created or truncated to the required size. Not available
+     * on Windows.
+     *
+     * @throws std::runtime_error if the file cannot be created or mapped
+     */
+    static APSPMatrix map_file(const std::string& path, std::size_t n) {
+        APSPMatrix m;
+        m.n_ = n;
+#ifdef _WIN32
+        (void)path;
+        throw std::runtime_error("File-backed APSP matrices are not supported on this platform");
+#else
+        m.bytes_ = n * n * sizeof(float);
+        m.fd_ = ::open(path.c_str(), O_RDWR | O_CREAT | O_TRUNC, 0644);
+        if (m.fd_ < 0) throw std::runtime_error("Cannot open APSP matrix file: " + path);
+        if (m.bytes_ == 0) return m;
+        if (::ftruncate(m.fd_, static_cast<off_t>(m.bytes_)) != 0) {
+            throw std::runtime_error("Cannot resize APSP matrix file: " + path);
+        }
+        void* p = ::mmap(nullptr, m.bytes_, PROT_READ | PROT_WRITE, MAP_SHARED, m.fd_, 0);
+        if (p == MAP_FAILED) throw std::runtime_error("Cannot map APSP matrix file: " + path);
+        m.data_ = static_cast<float*>(p);
+        return m;
+#endif
+    }
+
+    APSPMatrix(const APSPMatrix&) = delete;
+    APSPMatrix& operator=(const APSPMatrix&) = delete;
+    APSPMatrix(APSPMatrix&& other) noexcept { swap(other); }
+    APSPMatrix& operator=(APSPMatrix&& other) noexcept {
+        APSPMatrix tmp(std::move(other));
+        swap(tmp);
+        return *this;
+    }
+    ~APSPMatrix() { release(); }
+
+    [[nodiscard]] std::size_t size() const noexcept { return n_; }
+    [[nodiscard]] float* data() noexcept { return data_; }
+    [[nodiscard]] const float* data() const noexcept { return data_; }
+    [[nodiscard]] float at(std::size_t i, std::size_t j) const { return data_[i * n_ + j]; }
+    [[nodiscard]] const float* row(std::size_t i) const { return data_ + i * n_; }
+    [[nodiscard]] bool is_mapped() const noexcept { return fd_ >= 0; }
+
+private:
+    std::size_t n_ = 0;
+    std::vector<float> heap_;
+    float* data_ = nullptr;
+    int fd_ = -1;
+    std::size_t bytes_ = 0;
+
+    void swap(APSPMatrix& other) noexcept {
+        std::swap(n_, other.n_);
+        heap_.swap(other.heap_);   // keeps data() valid: vector storage moves with it
+        std::swap(data_, other.data_);
+        std::swap(fd_, other.fd_);
+        std::swap(bytes_, other.bytes_);
+    }
+
+    void release() noexcept {
+#ifndef _WIN32
+        if (fd_ >= 0) {
+            if (data_ && bytes_ > 0) ::munmap(data_, bytes_);
+            ::close(fd_);
+        }
+#endif
+        fd_ = -1;
+        data_ = nullptr;
+    }
+};
+
+namespace detail {
+
+constexpr std::size_t APSP_TILE = 64;   // 64 x 64 floats = 16 KB per tile
+
+// D[i][j] = min(D[i][j], D[i][k] + D[k][j]) over the tile, k outermost.
+// Needed when the tile overlaps row or column block k.
+inline void fw_tile_dependent(float* D, std::size_t n, std::size_t i0, std::size_t i1,
+                              std::size_t j0, std::size_t j1, std::size_t k0, std::size_t k1) {
+    const float inf = std::numeric_limits<float>::infinity();
+    for (std::size_t k = k0; k < k1; ++k) {
+        const float* Dk = D + k * n;
+        for (std::size_t i = i0; i < i1; ++i) {
+            float* Di = D + i * n;
+            const float dik = Di[k];
+            if (dik == inf) continue;
+            for (std::size_t j = j0; j < j1; ++j) {
+                const float c = dik + Dk[j];
+                Di[j] = c < Di[j] ? c : Di[j];
+            }
+        }
+    }
+}
+
+// Same update for a tile disjoint from block k: D[i][k] and D[k][j] are
+// final, so rows can be swept i-k-j and the inner loop vectorizes.
+inline void fw_tile_independent(float* D, std::size_t n, std::size_t i0, std::size_t i1,
+                                std::size_t j0, std::size_t j1, std::size_t k0, std::size_t k1) {
+    const float inf = std::numeric_limits<float>::infinity();
+    for (std::size_t i = i0; i < i1; ++i) {
+        float* Di = D + i * n;
+        for (std::size_t k = k0; k < k1; ++k) {
+            const float dik = Di[k];
+            if (dik == inf) continue;
+            const float* Dk = D + k * n;
+            for (std::size_t j = j0; j < j1; ++j) {
+                const float c = dik + Dk[j];
+                Di[j] = c < Di[j] ? c : Di[j];
+            }
+        }
+    }
+}
+
+inline void floyd_warshall(const Graph& G, float* D, std::size_t threads) {
+    const std::size_t n = G.num_vertices();
+    const float inf = std::numeric_limits<float>::infinity();
+    std::fill(D, D + n * n, inf);
+    for (VertexId v = 0; v < n; ++v) D[v * n + v] = 0.0f;
+    for (const auto& e : G.edges()) {
+        float& d = D[e.source().id() * n + e.destination().id()];
+        d = std::min(d, static_cast<float>(e.weight()));
+    }
+
+    const std::size_t B = APSP_TILE;
+    const std::size_t blocks = (n + B - 1) / B;
+    auto lo = [&](std::size_t b) { return b * B; };
+    auto hi = [&](std::size_t b) { return std::min(n, (b + 1) * B); };
+
+    for (std::size_t kb = 0; kb < blocks; ++kb) {
+        const std::size_t k0 = lo(kb), k1 = hi(kb);
+        // Phase 1: diagonal tile
+        fw_tile_dependent(D, n, k0, k1, k0, k1, k0, k1);
+        // Phase 2: tiles in row and column block kb
+        parallel_for(2 * blocks, threads, [&](std::size_t x, std::size_t) {
+            const std::size_t b = x % blocks;
+            if (b == kb) return;
+            if (x < blocks) fw_tile_dependent(D, n, k0, k1, lo(b), hi(b), k0, k1);
+            else fw_tile_dependent(D, n, lo(b), hi(b), k0, k1, k0, k1);
+        });
+        // Phase 3: all remaining tiles
+        parallel_for(blocks * blocks, threads, [&](std::size_t x, std::size_t) {
+            const std::size_t ib = x / blocks, jb = x % blocks;
+            if (ib == kb || jb == kb) return;
+            fw_tile_independent(D, n, lo(ib), hi(ib), lo(jb), hi(jb), k0, k1);
+        });
+    }
+}
+
+inline void repeated_sssp(const Graph& G, float* D, std::size_t threads) {
+    const std::size_t n = G.num_vertices();
+    std::vector<std::size_t> offsets(n + 1, 0);
+    std::vector<VertexId> heads;
+    std::vector<Weight> weights;
+    heads.reserve(G.num_edges());
+    weights.reserve(G.num_edges());
+    for (VertexId u = 0; u < n; ++u) {
+        for (const auto& e : G.get_outgoing_edges(u)) {
+            heads.push_back(e.destination().id());
+            weights.push_back(e.weight());
+        }
+        offsets[u + 1] = heads.size();
+    }
+
+    std::vector<MatrixWorkspace> workspaces(threads);
+    parallel_for(n, threads, [&](std::size_t s, std::size_t tid) {
+        auto& ws = workspaces[tid];
+        if (ws.dist.size() != n) ws.dist.assign(n, INFINITE_WEIGHT);
+        ws.dist[s] = 0.0;
+        ws.touched.push_back(s);
+        ws.heap.insert(Vertex(s), 0.0);
+        while (!ws.heap.empty()) {
+            auto [u, du] = ws.heap.extract_min();
+            for (std::size_t a = offsets[u.id()]; a < offsets[u.id() + 1]; ++a) {
+                const VertexId v = heads[a];
+                const Weight alt = du + weights[a];
+                if (alt < ws.dist[v]) {
+                    if (ws.dist[v] == INFINITE_WEIGHT) ws.touched.push_back(v);
+                    ws.dist[v] = alt;
+                    ws.heap.insert(Vertex(v), alt);
+                }
+            }
+        }
+        float* out = D + s * n;
+        for (VertexId v = 0; v < n; ++v) out[v] = static_cast<float>(ws.dist[v]);
+        for (VertexId v : ws.touched) ws.dist[v] = INFINITE_WEIGHT;
+        ws.touched.clear();
+        ws.heap.clear();
+    });
+}
+
+} // namespace detail
+
+/**
+ * @brief Method Auto picks for G
+ *
+ * Floyd-Warshall does n^3 vectorized min-plus updates regardless of the
+ * edge count; repeated SSSP does about n (n + m) log n heap work. A min-plus
+ * update is so much cheaper than a heap operation that on graphs of a few
+ * thousand vertices the measured break-even sits near average degree n / 50.
+ */
+inline APSPMethod choose_apsp_method(const Graph& G) {
+    const double n = static_cast<double>(G.num_vertices());
+    const double m = static_cast<double>(G.num_edges());
+    if (n < 2) return APSPMethod::RepeatedSSSP;
+    return n * n <= 50.0 * (n + m) ? APSPMethod::FloydWarshall : APSPMethod::RepeatedSSSP;
+}
+
+/**
+ * @brief All-pairs shortest paths into a caller-provided n x n float buffer
+ *
+ * out[i * n + j] = d(i, j), infinity if unreachable; vertex ids must be
+ * dense in [0, n). Distances are rounded to float. Floyd-Warshall works in
+ * place on out in 64 x 64 tiles with the three-phase blocked schedule
+ * (diagonal tile, then its row and column, then the rest in parallel).
+ * Repeated SSSP runs one Dijkstra per source over a shared CSR copy of the
+ * adjacency, with a reusable workspace per thread.
+ *
+ * @return The method that was used
+ */
+inline APSPMethod apsp(const Graph& G, float* out, const APSPOptions& opts = APSPOptions()) {
+    const std::size_t n = G.num_vertices();
+    APSPMethod method = opts.method == APSPMethod::Auto ? choose_apsp_method(G) : opts.method;
+    if (n == 0) return method;
+    const std::size_t threads = resolve_threads(opts.num_threads);
+    if (method == APSPMethod::FloydWarshall) detail::floyd_warshall(G, out, threads);
+    else detail::repeated_sssp(G, out, threads);
+    return method;
+}
+
+/**
+ * @brief All-pairs shortest paths into an existing matrix (e.g. map_file)
+ *
+ * @throws std::invalid_argument if out is not num_vertices() x num_vertices()
+ */
+inline APSPMethod apsp(const Graph& G, APSPMatrix& out, const APSPOptions& opts = APSPOptions()) {
+    if (out.size() != G.num_vertices()) {
+        throw std::invalid_argument("APSP matrix size does not match the graph");
+    }
+    return apsp(G, out.data(), opts);
+}
+
+inline APSPMatrix apsp(const Graph& G, const APSPOptions& opts = APSPOptions()) {
+    APSPMatrix out(G.num_vertices());
+    apsp(G, out, opts);
+    return out;
+}
+
+} // namespace sssp
+
+#endif // SSSP_APSP_HPP
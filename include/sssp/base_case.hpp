@@ -12,6 +12,7 @@
 #include <limits>
 #include <utility>
 #include <vector>
+#include <algorithm>
 
 namespace sssp {
 
@@ -22,44 +23,89 @@ struct BaseCaseResult {
 
 class BaseCase {
 public:
-    static BaseCaseResult run(const Graph& G, Weight B, const Vertex& x, DistState& state, std::size_t k [[maybe_unused]]) {
+    // dir = Incoming relaxes edges backwards; pred then holds successors.
+    static BaseCaseResult run(const Graph& G, Weight B, const Vertex& x, DistState& state, std::size_t k,
+                              EdgeDirection dir = EdgeDirection::Outgoing) {
+        if (G.has_vertex(x) && state.get(x.id()) == INFINITE_WEIGHT) state.set(x.id(), 0.0);
+        return run(G, B, std::vector<Vertex>{x}, state, k, dir);
+    }
+
+    // Multi-source form: every vertex of S with an estimate below B seeds the
+    // heap at its current distance, built in one O(|S|) heapify.
+    //
+    // Bounded as in Algorithm 2: the search stops after k|S| + 1 settled
+    // vertices (k + 1 for a single source). If the heap still holds entries
+    // below B, B' is the smallest of them and U is everything settled, all
+    // strictly below B'; settling runs on past the limit only through ties,
+    // so U is never empty. Otherwise everything reachable under B is
+    // complete and B' = B.
+    static BaseCaseResult run(const Graph& G, Weight B, const std::vector<Vertex>& S, DistState& state,
+                              std::size_t k, EdgeDirection dir = EdgeDirection::Outgoing) {
 #ifdef SSSP_PROFILE
         ScopeTimer timer(&prof().basecase_ns);
+        prof().basecase_calls++;
 #endif
         BaseCaseResult res{B, {}};
-        if (!G.has_vertex(x)) return res;
-        BinaryHeap H;
-        if (state.get(x.id()) == INFINITE_WEIGHT) state.set(x.id(), 0.0);
-        H.insert(x, state.get(x.id()));
+        std::vector<std::pair<Vertex, Weight>> seeds;
+        seeds.reserve(S.size());
+        std::unordered_set<Vertex> seeded;
+        for (const auto& x : S) {
+            if (!G.has_vertex(x) || state.get(x.id()) >= B) continue;
+            if (seeded.insert(x).second) seeds.emplace_back(x, state.get(x.id()));
+        }
+        if (seeds.empty()) return res;
+        const std::size_t per_seed = std::max<std::size_t>(k, 1);
+        const std::size_t limit = per_seed >= (std::numeric_limits<std::size_t>::max() - 1) / seeds.size()
+                                      ? std::numeric_limits<std::size_t>::max()
+                                      : per_seed * seeds.size() + 1;
+        BinaryHeap& H = scratch_heap();
+        H.build_heap(seeds);
         std::unordered_set<Vertex> in_U;
         while (!H.empty()) {
-            auto [u, du] = H.extract_min();
-            if (du >= B) { res.B_prime = B; break; }
-            if (in_U.insert(u).second) res.U.push_back(u);
-            for (const auto& e : G.get_outgoing_edges(u)) {
-                Vertex v = e.destination();
+            auto [u, du] = H.peek_min();
+            if (du >= B) break;
+            if (res.U.size() >= limit && du > state.get(res.U.back().id())) {
+                res.B_prime = du;
+                break;
+            }
+            H.extract_min();
+#ifdef SSSP_PROFILE
+            prof().basecase_pops++;
+#endif
+            if (!in_U.insert(u).second) continue;
+            res.U.push_back(u);
+            for (const auto& e : G.get_edges(u, dir)) {
+                Vertex v = Graph::far_end(e, dir);
                 Weight alt = du + e.weight();
                 Weight dv = state.get(v.id());
                 if (alt <= B && alt <= dv) {
                     bool better = alt < dv;
-                    if (better || alt == dv) {
-                        if (better) state.set(v.id(), alt);
-                        state.set_pred(v.id(), u.id());
+                    // Equal-distance re-pushes are only needed for vertices that are
+                    // not settled yet; re-opening settled ones loops on zero-weight cycles.
+                    // pred moves only on a strict improvement: a tie may come from a
+                    // vertex below v in the tree and would close a pred cycle.
+                    if (better || in_U.find(v) == in_U.end()) {
+                        if (better) {
+                            state.set(v.id(), alt);
+                            state.set_pred(v.id(), u.id());
+                        }
                         H.insert(v, alt);
                     }
                 }
             }
         }
-        // Set B_prime to the maximum distance found, or B if no vertices were explored
-        if (!res.U.empty()) {
-            Weight max_dist = 0.0;
-            for (const auto& u : res.U) {
-                max_dist = std::max(max_dist, state.get(u.id()));
-            }
-            res.B_prime = max_dist;
-        }
+        H.clear();
         return res;
     }
+
+private:
+    // One heap per thread, reused across calls: the heap's position map is
+    // indexed by vertex id, so a fresh heap costs O(max id) to grow while a
+    // bounded call settles only k|S| + 1 vertices.
+    static BinaryHeap& scratch_heap() {
+        thread_local BinaryHeap heap;
+        return heap;
+    }
 };
 
 } // namespace sssp
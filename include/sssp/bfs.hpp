@@ -0,0 +1,161 @@
+#ifndef SSSP_BFS_HPP
+#define SSSP_BFS_HPP
+
+#include "sssp/types.hpp"
+#include "sssp/graph.hpp"
+#include "sssp/parallel.hpp"
+#include <vector>
+#include <atomic>
+#include <cstdint>
+#include <algorithm>
+
+namespace sssp {
+
+struct BFSOptions {
+    std::size_t num_threads = 0;   // 0 = hardware concurrency
+    double alpha = 15.0;           // go bottom-up when frontier edges > unexplored edges / alpha
+    double beta = 18.0;            // go back top-down when frontier size < n / beta
+};
+
+/**
+ * @brief Direction-optimizing BFS for graphs whose edges share one weight
+ *
+ * With a common weight w, d(s, v) = w * hops(s, v), so SSSP reduces to BFS.
+ * Each level is expanded either top-down (frontier vertices claim their
+ * unvisited out-neighbours) or bottom-up (unvisited vertices look for a
+ * parent in the frontier bitmap through their in-edges), switching with
+ * the Beamer et al. heuristic: bottom-up pays off once the frontier's
+ * out-edges outnumber the unexplored edges by a factor alpha.
+ *
+ * Levels are processed in parallel. Top-down claims vertices with an atomic
+ * compare-and-swap on the parent array; bottom-up gives each thread whole
+ * 64-vertex words of the next-frontier bitmap, so it needs no atomics.
+ *
+ * Output matches solveSSSP: dist in the caller's DistState (dense by vertex
+ * id, INFINITE_WEIGHT if unreachable) and pred = BFS parent. dir = Incoming
+ * searches the reverse graph and yields successors, as solveReverseSSSP.
+ */
+class DirectionOptimizingBFS {
+public:
+    static void run(const Graph& G, const Vertex& source, Weight unit, DistState& state,
+                    EdgeDirection dir = EdgeDirection::Outgoing, const BFSOptions& opts = BFSOptions()) {
+        const std::size_t n = G.num_vertices();
+        state.init(n);
+        if (source.id() >= n) return;
+
+        // Forward and backward CSR for the chosen direction
+        std::vector<std::size_t> fwd_off, bwd_off;
+        std::vector<VertexId> fwd, bwd;
+        build_csr(G, dir, fwd_off, fwd);
+        build_csr(G, dir == EdgeDirection::Outgoing ? EdgeDirection::Incoming : EdgeDirection::Outgoing,
+                  bwd_off, bwd);
+
+        const std::size_t threads = resolve_threads(opts.num_threads);
+        const std::size_t words = (n + 63) / 64;
+        std::vector<std::atomic<VertexId>> parent(n);
+        for (auto& p : parent) p.store(INVALID_VERTEX, std::memory_order_relaxed);
+        std::vector<std::uint32_t> level(n, UNREACHED);
+        std::vector<std::uint64_t> front_bits(words, 0), next_bits(words, 0);
+        std::vector<VertexId> frontier = {source.id()}, next;
+        std::vector<std::vector<VertexId>> local_next(threads);
+
+        const VertexId s = source.id();
+        parent[s].store(s, std::memory_order_relaxed);
+        level[s] = 0;
+        std::size_t unexplored_edges = fwd.size() - (fwd_off[s + 1] - fwd_off[s]);
+        bool bottom_up = false;
+        std::uint32_t depth = 0;
+
+        while (!frontier.empty()) {
+            std::size_t frontier_edges = 0;
+            for (VertexId u : frontier) frontier_edges += fwd_off[u + 1] - fwd_off[u];
+            if (!bottom_up && static_cast<double>(frontier_edges) > static_cast<double>(unexplored_edges) / opts.alpha) {
+                bottom_up = true;
+            } else if (bottom_up && static_cast<double>(frontier.size()) < static_cast<double>(n) / opts.beta) {
+                bottom_up = false;
+            }
+            depth++;
+            next.clear();
+
+            if (bottom_up) {
+                std::fill(front_bits.begin(), front_bits.end(), 0);
+                for (VertexId u : frontier) front_bits[u / 64] |= std::uint64_t(1) << (u % 64);
+                std::fill(next_bits.begin(), next_bits.end(), 0);
+                const std::size_t chunks = (words + WORDS_PER_CHUNK - 1) / WORDS_PER_CHUNK;
+                parallel_for(chunks, threads, [&](std::size_t c, std::size_t) {
+                    const VertexId lo = c * WORDS_PER_CHUNK * 64;
+                    const VertexId hi = std::min<VertexId>(n, lo + WORDS_PER_CHUNK * 64);
+                    for (VertexId v = lo; v < hi; ++v) {
+                        if (level[v] != UNREACHED) continue;
+                        for (std::size_t i = bwd_off[v]; i < bwd_off[v + 1]; ++i) {
+                            const VertexId u = bwd[i];
+                            if (front_bits[u / 64] >> (u % 64) & 1) {
+                                parent[v].store(u, std::memory_order_relaxed);
+                                next_bits[v / 64] |= std::uint64_t(1) << (v % 64);
+                                break;
+                            }
+                        }
+                    }
+                });
+                for (std::size_t w = 0; w < words; ++w) {
+                    std::uint64_t bits = next_bits[w];
+                    for (VertexId b = 0; bits; ++b, bits >>= 1) {
+                        if (bits & 1) next.push_back(w * 64 + b);
+                    }
+                }
+            } else {
+                const std::size_t chunks = (frontier.size() + VERTICES_PER_CHUNK - 1) / VERTICES_PER_CHUNK;
+                for (auto& l : local_next) l.clear();
+                parallel_for(chunks, threads, [&](std::size_t c, std::size_t tid) {
+                    const std::size_t lo = c * VERTICES_PER_CHUNK;
+                    const std::size_t hi = std::min(frontier.size(), lo + VERTICES_PER_CHUNK);
+                    for (std::size_t k = lo; k < hi; ++k) {
+                        const VertexId u = frontier[k];
+                        for (std::size_t i = fwd_off[u]; i < fwd_off[u + 1]; ++i) {
+                            const VertexId v = fwd[i];
+                            VertexId expected = INVALID_VERTEX;
+                            if (parent[v].load(std::memory_order_relaxed) == INVALID_VERTEX &&
+                                parent[v].compare_exchange_strong(expected, u, std::memory_order_relaxed)) {
+                                local_next[tid].push_back(v);
+                            }
+                        }
+                    }
+                });
+                for (const auto& l : local_next) next.insert(next.end(), l.begin(), l.end());
+            }
+
+            for (VertexId v : next) {
+                level[v] = depth;
+                unexplored_edges -= std::min(unexplored_edges, fwd_off[v + 1] - fwd_off[v]);
+            }
+            frontier.swap(next);
+        }
+
+        for (VertexId v = 0; v < n; ++v) {
+            if (level[v] == UNREACHED) continue;
+            state.set(v, unit * level[v]);
+            if (v != s) state.set_pred(v, parent[v].load(std::memory_order_relaxed));
+        }
+    }
+
+private:
+    static constexpr std::uint32_t UNREACHED = static_cast<std::uint32_t>(-1);
+    static constexpr std::size_t WORDS_PER_CHUNK = 64;       // 4096 vertices per bottom-up task
+    static constexpr std::size_t VERTICES_PER_CHUNK = 1024;  // frontier vertices per top-down task
+
+    static void build_csr(const Graph& G, EdgeDirection dir, std::vector<std::size_t>& offsets,
+                          std::vector<VertexId>& heads) {
+        const std::size_t n = G.num_vertices();
+        offsets.assign(n + 1, 0);
+        heads.clear();
+        heads.reserve(G.num_edges());
+        for (VertexId u = 0; u < n; ++u) {
+            for (const auto& e : G.get_edges(Vertex(u), dir)) heads.push_back(Graph::far_end(e, dir).id());
+            offsets[u + 1] = heads.size();
+        }
+    }
+};
+
+} // namespace sssp
+
+#endif // SSSP_BFS_HPP
@@ -0,0 +1,112 @@
+#ifndef SSSP_BIDIRECTIONAL_HPP
+#define SSSP_BIDIRECTIONAL_HPP
+
+#include "sssp/types.hpp"
+#include "sssp/graph.hpp"
+#include "sssp/binary_heap.hpp"
+#include <vector>
+#include <limits>
+#include <algorithm>
+
+namespace sssp {
+
+struct BidirectionalResult {
+    Weight distance;
+    std::vector<Vertex> path;   // source ... target, empty if unreachable
+    std::size_t settled;        // vertices settled by both searches together
+};
+
+/**
+ * @brief Point-to-point shortest path via bidirectional Dijkstra
+ *
+ * A forward search runs on outgoing edges from the source and a backward
+ * search runs on incoming edges from the target. The side with the smaller
+ * frontier is advanced next. Every relaxed edge whose head has already been
+ * reached by the opposite search yields a candidate s-t distance mu; the
+ * search stops once top_f + top_b >= mu, at which point mu is exact.
+ *
+ * Vertex ids are assumed dense in [0, n), as for DistState.
+ */
+class BidirectionalSearch {
+public:
+    static BidirectionalResult run(const Graph& G, const Vertex& source, const Vertex& target) {
+        BidirectionalResult res{INFINITE_WEIGHT, {}, 0};
+        if (!G.has_vertex(source) || !G.has_vertex(target)) return res;
+        if (source == target) {
+            res.distance = 0.0;
+            res.path.push_back(source);
+            return res;
+        }
+
+        const std::size_t n = G.num_vertices();
+        std::vector<Weight> dist_f(n, INFINITE_WEIGHT), dist_b(n, INFINITE_WEIGHT);
+        std::vector<VertexId> pred_f(n, INVALID_VERTEX), succ_b(n, INVALID_VERTEX);
+        std::vector<char> done_f(n, 0), done_b(n, 0);
+        BinaryHeap Hf, Hb;
+
+        dist_f[source.id()] = 0.0;
+        dist_b[target.id()] = 0.0;
+        Hf.insert(source, 0.0);
+        Hb.insert(target, 0.0);
+
+        // Best meeting edge found so far: mu = dist_f[meet_u] + w + dist_b[meet_v]
+        Weight mu = INFINITE_WEIGHT;
+        VertexId meet_u = INVALID_VERTEX, meet_v = INVALID_VERTEX;
+
+        while (!Hf.empty() && !Hb.empty()) {
+            if (Hf.peek_min().second + Hb.peek_min().second >= mu) break;
+
+            if (Hf.size() <= Hb.size()) {
+                auto [u, du] = Hf.extract_min();
+                done_f[u.id()] = 1;
+                res.settled++;
+                for (const auto& e : G.get_outgoing_edges(u)) {
+                    const VertexId v = e.destination().id();
+                    const Weight alt = du + e.weight();
+                    if (alt < dist_f[v] && !done_f[v]) {
+                        dist_f[v] = alt;
+                        pred_f[v] = u.id();
+                        Hf.insert(e.destination(), alt);
+                    }
+                    if (dist_b[v] < INFINITE_WEIGHT && alt + dist_b[v] < mu) {
+                        mu = alt + dist_b[v];
+                        meet_u = u.id();
+                        meet_v = v;
+                    }
+                }
+            } else {
+                auto [u, du] = Hb.extract_min();
+                done_b[u.id()] = 1;
+                res.settled++;
+                for (const auto& e : G.get_incoming_edges(u)) {
+                    const VertexId v = e.source().id();
+                    const Weight alt = du + e.weight();
+                    if (alt < dist_b[v] && !done_b[v]) {
+                        dist_b[v] = alt;
+                        succ_b[v] = u.id();
+                        Hb.insert(e.source(), alt);
+                    }
+                    if (dist_f[v] < INFINITE_WEIGHT && dist_f[v] + alt < mu) {
+                        mu = dist_f[v] + alt;
+                        meet_u = v;
+                        meet_v = u.id();
+                    }
+                }
+            }
+        }
+
+        if (mu == INFINITE_WEIGHT) return res;
+        res.distance = mu;
+
+        // Stitch: forward predecessor chain up to meet_u, then the meeting
+        // edge, then the backward successor chain from meet_v to the target.
+        for (VertexId v = meet_u; v != INVALID_VERTEX; v = pred_f[v]) res.path.push_back(Vertex(v));
+        std::reverse(res.path.begin(), res.path.end());
+        for (VertexId v = meet_v; v != INVALID_VERTEX; v = succ_b[v]) res.path.push_back(Vertex(v));
+        return res;
+    }
+};
+
+} // namespace sssp
+
+#endif // SSSP_BIDIRECTIONAL_HPP
@@ -4,7 +4,6 @@
 #include "sssp/types.hpp"
 #include "sssp/vertex.hpp"
 #include <vector>
-#include <unordered_map>
 #include <stdexcept>
 #include <limits>
 #include <algorithm>
@@ -25,7 +24,10 @@ namespace sssp {
  * - Contains: O(1)
  * 
  * The heap maintains a mapping from vertices to their positions in the heap
- * for efficient DecreaseKey operations.
+ * for efficient DecreaseKey operations. The mapping is a dense vector indexed
+ * by vertex id that grows on demand, so lookups on the hot path are plain
+ * array reads; clear() only resets the slots of vertices still in the heap,
+ * which keeps reusing one heap across many searches cheap.
  */
 class BinaryHeap {
 public:
@@ -53,9 +55,9 @@ private:
     // The heap array (0-indexed)
     std::vector<HeapEntry> heap_;
     
-    // Maps vertex to its current position in the heap
+    // Maps vertex id to its current position in the heap
     // -1 indicates vertex is not in heap
-    std::unordered_map<Vertex, int> position_map_;
+    std::vector<int> position_map_;
     
     // Current number of elements in heap
     std::size_t size_;
@@ -81,6 +83,25 @@ private:
         return 2 * i + 2;
     }
     
+    /**
+     * @brief Position of vertex, or -1 if it is not in the heap
+     */
+    int position(const Vertex& vertex) const {
+        const std::size_t id = vertex.id();
+        return id < position_map_.size() ? position_map_[id] : -1;
+    }
+    
+    /**
+     * @brief Record the position of vertex, growing the map if needed
+     */
+    void set_position(const Vertex& vertex, int pos) {
+        const std::size_t id = vertex.id();
+        if (id >= position_map_.size()) {
+            position_map_.resize(std::max(id + 1, position_map_.size() * 2), -1);
+        }
+        position_map_[id] = pos;
+    }
+    
     /**
      * @brief Swap two elements in the heap and update position map
      */
@@ -88,8 +109,8 @@ private:
         if (i == j) return;
         
         // Update position map
-        position_map_[heap_[i].vertex] = j;
-        position_map_[heap_[j].vertex] = i;
+        position_map_[heap_[i].vertex.id()] = j;
+        position_map_[heap_[j].vertex.id()] = i;
         
         // Swap entries
         std::swap(heap_[i], heap_[j]);
@@ -149,7 +170,6 @@ public:
      */
     explicit BinaryHeap(std::size_t initial_capacity = 1000) : size_(0) {
         heap_.reserve(initial_capacity);
-        position_map_.reserve(initial_capacity);
     }
     
     /**
@@ -170,8 +190,10 @@ public:
      * @brief Clear all elements from heap
      */
     void clear() {
+        for (std::size_t i = 0; i < size_; i++) {
+            position_map_[heap_[i].vertex.id()] = -1;
+        }
         heap_.clear();
-        position_map_.clear();
         size_ = 0;
     }
     
@@ -182,9 +204,7 @@ public:
      * @return true if vertex is in heap
      */
     bool contains(const Vertex& vertex) const {
-        auto it = position_map_.find(vertex);
-        return it != position_map_.end() && it->second >= 0 && 
-               it->second < static_cast<int>(size_);
+        return position(vertex) >= 0;
     }
     
     /**
@@ -194,10 +214,9 @@ public:
      * @return Distance of vertex (infinity if not in heap)
      */
     Weight get_distance(const Vertex& vertex) const {
-        auto it = position_map_.find(vertex);
-        if (it != position_map_.end() && it->second >= 0 && 
-            it->second < static_cast<int>(size_)) {
-            return heap_[it->second].distance;
+        const int pos = position(vertex);
+        if (pos >= 0) {
+            return heap_[pos].distance;
         }
         return std::numeric_limits<Weight>::infinity();
     }
@@ -214,11 +233,10 @@ public:
      */
     bool insert(const Vertex& vertex, Weight distance) {
         // Check if vertex already exists
-        auto it = position_map_.find(vertex);
-        if (it != position_map_.end() && it->second >= 0 && 
-            it->second < static_cast<int>(size_)) {
+        const int pos = position(vertex);
+        if (pos >= 0) {
             // Vertex exists - only update if new distance is smaller
-            if (distance < heap_[it->second].distance) {
+            if (distance < heap_[pos].distance) {
                 return decrease_key(vertex, distance);
             }
             return false;  // No update needed
@@ -231,7 +249,7 @@ public:
             heap_[size_] = HeapEntry(vertex, distance);
         }
         
-        position_map_[vertex] = static_cast<int>(size_);
+        set_position(vertex, static_cast<int>(size_));
         size_++;
         
         // Restore heap property
@@ -256,10 +274,10 @@ public:
         
         // Move last element to root
         heap_[0] = heap_[size_ - 1];
-        position_map_[heap_[0].vertex] = 0;
+        position_map_[heap_[0].vertex.id()] = 0;
         
         // Remove the minimum vertex from position map
-        position_map_.erase(min_entry.vertex);
+        position_map_[min_entry.vertex.id()] = -1;
         
         // Decrease size
         size_--;
@@ -294,14 +312,11 @@ public:
      */
     bool decrease_key(const Vertex& vertex, Weight new_distance) {
         // Find vertex in heap
-        auto it = position_map_.find(vertex);
-        if (it == position_map_.end() || it->second < 0 || 
-            it->second >= static_cast<int>(size_)) {
+        int index = position(vertex);
+        if (index < 0) {
             return false;  // Vertex not in heap
         }
         
-        int index = it->second;
-        
         // Check if new distance is actually smaller
         if (new_distance >= heap_[index].distance) {
             return false;  // New distance is not smaller
@@ -329,12 +344,11 @@ public:
         
         // Reserve space
         heap_.reserve(entries.size());
-        position_map_.reserve(entries.size());
         
         // Copy entries
         for (const auto& [vertex, distance] : entries) {
             heap_.emplace_back(vertex, distance);
-            position_map_[vertex] = static_cast<int>(size_);
+            set_position(vertex, static_cast<int>(size_));
             size_++;
         }
         
@@ -365,8 +379,7 @@ public:
         
         // Check position map consistency
         for (std::size_t i = 0; i < size_; i++) {
-            auto it = position_map_.find(heap_[i].vertex);
-            if (it == position_map_.end() || it->second != static_cast<int>(i)) {
+            if (position(heap_[i].vertex) != static_cast<int>(i)) {
                 return false;
             }
         }
@@ -388,7 +401,6 @@ public:
      */
     void reserve(std::size_t new_capacity) {
         heap_.reserve(new_capacity);
-        position_map_.reserve(new_capacity);
     }
 };
 
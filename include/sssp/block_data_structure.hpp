@@ -283,7 +283,7 @@ public:
      * @brief Pull M smallest elements from the data structure
      * 
      * Returns a subset of M keys with smallest values and a boundary.
-     * Collects from prefix of D0 and D1 blocks.
+     * Collects from the fronts of the D0 and D1 block sequences.
      * 
      * Amortized Time: O(|S'|)
      * 
@@ -291,112 +291,28 @@ public:
      */
     std::pair<std::vector<KeyValuePair>, Value> Pull() {
         std::vector<KeyValuePair> result;
-        result.reserve(M_);
-        Value boundary = B_;
+        result.reserve(std::min(M_, total_elements_));
         
         if (empty()) {
-            return {result, boundary};
+            return {result, B_};
         }
         
-        // Track blocks to remove after pulling
-        std::vector<typename std::list<BlockPtr>::iterator> d0_to_remove; d0_to_remove.reserve(8);
-        std::vector<typename std::list<BlockPtr>::iterator> d1_to_remove; d1_to_remove.reserve(8);
-        
-        // First, collect from D0 blocks
-        for (auto d0_it = D0_.begin(); d0_it != D0_.end() && result.size() < M_; ++d0_it) {
-            BlockPtr block = *d0_it;
-            std::size_t to_take = std::min(M_ - result.size(), block->elements.size());
-            
-            auto elem_it = block->elements.begin();
-            for (std::size_t i = 0; i < to_take; ++i, ++elem_it) {
-                result.push_back(*elem_it);
-            }
-            if (to_take == block->elements.size()) {
-                d0_to_remove.push_back(d0_it);
-            } else {
-                block->elements.erase(block->elements.begin(), elem_it);
-                if (result.size() >= M_) {
-                    boundary = block->min_value();
-                }
-                break;
-            }
+        // The M smallest live pairs, merged from the fronts of D0 and D1
+        KeyValuePair next;
+        while (result.size() < M_ && pop_min_up_to(std::numeric_limits<Value>::infinity(), next)) {
+            result.push_back(next);
         }
-        
-        // If we haven't collected enough, continue with D1
-        if (result.size() < M_) {
-            for (auto d1_it = D1_.begin(); d1_it != D1_.end() && result.size() < M_; ++d1_it) {
-                BlockPtr block = *d1_it;
-                
-                if (block->empty()) {
-                    continue;  // Skip empty blocks
-                }
-                
-                std::size_t to_take = std::min(M_ - result.size(), block->elements.size());
-                
-                auto elem_it = block->elements.begin();
-                for (std::size_t i = 0; i < to_take; ++i, ++elem_it) {
-                    result.push_back(*elem_it);
-                }
-                if (to_take == block->elements.size()) {
-                    d1_to_remove.push_back(d1_it);
-                } else {
-                    block->elements.erase(block->elements.begin(), elem_it);
-                    if (result.size() >= M_) {
-                        boundary = block->min_value();
-                    }
-                    break;
-                }
-            }
-        }
-        
-        // Remove fully consumed blocks from D0
-        for (auto it : d0_to_remove) {
-            D0_.erase(it);
-        }
-        
-        // Remove fully consumed blocks from D1 and update BST
-        for (auto it : d1_to_remove) {
-            Value old_bound = (*it)->upper_bound;
-            d1_upper_bounds_.erase(old_bound);
-            D1_.erase(it);
-        }
-        
-        // Update total elements and key tracking
-        total_elements_ -= result.size();
-        for (const auto& [key, value] : result) {
-            key_min_values_.erase(key);
+
+        // Keys tied with the largest pulled value go out with it: the
+        // boundary must be strictly above everything returned, otherwise a
+        // call bounded by it could never process the pulled ties.
+        if (!result.empty()) {
+            const Value top = result.back().second;
+            while (pop_min_up_to(top, next)) result.push_back(next);
         }
         
-        // Set boundary if we didn't pull full M elements
-        if (result.size() < M_ && !empty()) {
-            // Find next minimum value
-            Value next_min = B_;
-            
-            if (!D0_.empty() && !D0_.front()->empty()) {
-                next_min = std::min(next_min, D0_.front()->min_value());
-            }
-            
-            for (const auto& block : D1_) {
-                if (!block->empty()) {
-                    next_min = std::min(next_min, block->min_value());
-                    break;
-                }
-            }
-            
-            boundary = next_min;
-        } else if (result.size() == M_ && boundary == B_) {
-            // We pulled exactly M elements, set boundary to next element value
-            if (!D0_.empty() && !D0_.front()->empty()) {
-                boundary = D0_.front()->min_value();
-            } else {
-                for (const auto& block : D1_) {
-                    if (!block->empty()) {
-                        boundary = block->min_value();
-                        break;
-                    }
-                }
-            }
-        }
+        // The boundary is the smallest value left, or B once everything is out
+        const Value boundary = empty() ? B_ : std::min(B_, min_remaining());
         
         return {result, boundary};
     }
@@ -454,11 +370,76 @@ public:
     }
     
 private:
+    static typename std::list<BlockPtr>::iterator first_nonempty(std::list<BlockPtr>& seq) {
+        auto it = seq.begin();
+        while (it != seq.end() && (*it)->empty()) ++it;
+        return it;
+    }
+
+    // A pair is stale once its key got a smaller value elsewhere (Insert and
+    // BatchPrepend only record the new minimum) or was pulled already.
+    // Stale pairs are dropped lazily when they reach a block front.
+
+    // Smallest live value left; blocks are sorted, so it is a block front
+    Value min_remaining() {
+        for (;;) {
+            auto d0_it = first_nonempty(D0_);
+            auto d1_it = first_nonempty(D1_);
+            const bool from_d0 = d0_it != D0_.end() &&
+                                 (d1_it == D1_.end() || (*d0_it)->min_value() <= (*d1_it)->min_value());
+            if (!from_d0 && d1_it == D1_.end()) return std::numeric_limits<Value>::infinity();
+            const KeyValuePair& front = from_d0 ? (*d0_it)->elements.front() : (*d1_it)->elements.front();
+            if (should_keep_pair(front.first, front.second)) return front.second;
+            pop_front(from_d0 ? d0_it : d1_it, from_d0);
+        }
+    }
+
+    /**
+     * @brief Remove the smallest remaining live pair if its value is <= limit
+     *
+     * The smallest pair is at the front of the first non-empty block of
+     * D0 or of D1; stale pairs met on the way are discarded. Emptied
+     * blocks are dropped, except the last D1 block.
+     */
+    bool pop_min_up_to(Value limit, KeyValuePair& out) {
+        for (;;) {
+            auto d0_it = first_nonempty(D0_);
+            auto d1_it = first_nonempty(D1_);
+            if (d0_it == D0_.end() && d1_it == D1_.end()) return false;
+            const Value v0 = d0_it == D0_.end() ? std::numeric_limits<Value>::infinity() : (*d0_it)->min_value();
+            const Value v1 = d1_it == D1_.end() ? std::numeric_limits<Value>::infinity() : (*d1_it)->min_value();
+            if (std::min(v0, v1) > limit) return false;
+
+            const bool from_d0 = d0_it != D0_.end() && v0 <= v1;
+            out = from_d0 ? (*d0_it)->elements.front() : (*d1_it)->elements.front();
+            pop_front(from_d0 ? d0_it : d1_it, from_d0);
+            if (should_keep_pair(out.first, out.second)) {
+                key_min_values_.erase(out.first);
+                return true;
+            }
+        }
+    }
+
+    void pop_front(typename std::list<BlockPtr>::iterator block_it, bool in_d0) {
+        (*block_it)->elements.pop_front();
+        total_elements_--;
+        if (!(*block_it)->empty()) return;
+        if (in_d0) {
+            D0_.erase(block_it);
+        } else if (std::next(block_it) != D1_.end()) {
+            auto bound = d1_upper_bounds_.find((*block_it)->upper_bound);
+            if (bound != d1_upper_bounds_.end() && bound->second == block_it) d1_upper_bounds_.erase(bound);
+            D1_.erase(block_it);
+        }
+    }
+
     /**
      * @brief Split a D1 block that exceeds size M
      * 
-     * Splits block into two roughly equal parts by finding median.
-     * Updates BST with new block bounds.
+     * Splits block into two roughly equal parts at the median. Equal values
+     * stay in one part, so the first part's upper bound (its largest value)
+     * is strictly below the second part's values and the bounds in the BST
+     * stay distinct. A block of one repeated value is left oversized.
      * 
      * @param block_it Iterator to the block in D1 list
      */
@@ -468,18 +449,24 @@ private:
             return;  // No need to split
         }
         
-        // Find median position
-        std::size_t mid = block->size() / 2;
-        auto mid_it = block->elements.begin();
-        std::advance(mid_it, mid);
+        // Find median position, then move it off a run of equal values
+        auto& elems = block->elements;
+        auto mid_it = elems.begin();
+        std::advance(mid_it, elems.size() / 2);
+        auto cut = mid_it;
+        while (cut != elems.end() && std::prev(cut)->second == cut->second) ++cut;
+        if (cut == elems.end()) {
+            cut = mid_it;
+            while (cut != elems.begin() && std::prev(cut)->second == cut->second) --cut;
+            if (cut == elems.begin()) return;
+        }
         auto new_block = std::make_shared<Block>();
         new_block->upper_bound = block->upper_bound;
-        new_block->elements.splice(new_block->elements.begin(), block->elements,
-                                    mid_it, block->elements.end());
+        new_block->elements.splice(new_block->elements.begin(), elems, cut, elems.end());
         
         // Update upper bound of first block
         Value old_upper = block->upper_bound;
-        block->upper_bound = new_block->min_value();
+        block->upper_bound = elems.back().second;
         
         // Update BST: remove old bound, add new bounds
         d1_upper_bounds_.erase(old_upper);
@@ -10,6 +10,10 @@
 #include <unordered_set>
 #include <vector>
 #include <limits>
+#include <cmath>
+#include <algorithm>
+#include <tuple>
+#include <utility>
 
 #ifdef SSSP_PROFILE
 #include "sssp/profiling.hpp"
@@ -22,87 +26,296 @@ struct BMSSPResult {
     std::vector<Vertex> U;
 };
 
+/**
+ * @brief Recursion parameters; 0 means derive from n
+ *
+ * The defaults are k = compute_k(n), t = compute_t(n), l = BMSSP::top_level(n, t),
+ * block size M = 2^{(l-1)t} per frame and BMSSP::kDefaultDijkstraCutoff.
+ * See tuning.hpp for loading tuned values from a file.
+ */
+struct BMSSPParams {
+    std::size_t k = 0;                 // FindPivots relaxation rounds
+    std::size_t t = 0;                 // level width: frames at level l settle up to k 2^{lt}
+    int l = 0;                         // recursion depth of the top call, at least top_level(n, t)
+    std::size_t block_size = 0;        // block size M of the frontier structure in every frame
+    std::size_t dijkstra_cutoff = 0;   // 1 = always recurse, see BMSSP::kDefaultDijkstraCutoff
+    bool adaptive = false;             // adapt k and M per frame, see FrameTuner
+    PivotRule pivots = PivotRule::Exact;   // frontier reduction in FindPivots
+
+    // True if nothing is overridden, i.e. every field is derived
+    [[nodiscard]] bool derived() const noexcept {
+        return k == 0 && t == 0 && l <= 0 && block_size == 0 && dijkstra_cutoff == 0 && !adaptive &&
+               pivots == PivotRule::Exact;
+    }
+};
+
+/**
+ * @brief Online choice of the FindPivots rounds k and the block size M per level
+ *
+ * Each recursion level starts at the proven values (k, and M = 2^{(l-1)t} or
+ * the fixed block size) and only moves below them, so every frame keeps its
+ * size bound k 2^{lt} and its base-case budget; only the work split changes.
+ *
+ * - k halves when FindPivots exits early (|W| > k|S|: the extra rounds were
+ *   spent on a frontier that stays whole) and doubles back when the pivots
+ *   cut the frontier to at most half. It stays at 2 or more, since a single
+ *   round makes every frontier vertex its own pivot.
+ * - M halves when a sub-call stops early (B'_i < B_i: the pull was more than
+ *   one sub-call could finish) and doubles back when a full pull completes.
+ *
+ * Choices apply from the next frame of the same level. The per-level
+ * statistics stay readable after the solve.
+ */
+class FrameTuner {
+public:
+    struct Level {
+        std::size_t k = 0;                   // current rounds (0 = level not seen yet)
+        std::size_t M = 0;                   // current block size
+        std::size_t frames = 0;
+        std::size_t pivot_early_exits = 0;   // FindPivots returned P = S after |W| > k|S|
+        double w_per_s = 0.0;                // sum over frames of |W| / |S|
+        std::size_t pulls = 0;
+        std::size_t pulled = 0;              // vertices handed to sub-calls
+        std::size_t partial_subcalls = 0;    // sub-calls with B'_i < B_i
+        std::size_t k_changes = 0;
+        std::size_t M_changes = 0;
+    };
+
+    [[nodiscard]] const std::vector<Level>& levels() const noexcept { return levels_; }
+
+    // Rounds and block size for the next frame at level l
+    std::pair<std::size_t, std::size_t> begin_frame(int l, std::size_t k_max, std::size_t M_max) {
+        Level& lv = level(l);
+        if (lv.k == 0) {
+            lv.k = k_max;
+            lv.M = M_max;
+        }
+        lv.k = std::min(lv.k, k_max);
+        lv.M = std::min(lv.M, M_max);
+        lv.frames++;
+        return {lv.k, lv.M};
+    }
+
+    void after_pivots(int l, std::size_t k_max, std::size_t S, std::size_t P, std::size_t W) {
+        Level& lv = level(l);
+        lv.w_per_s += (double)W / (double)std::max<std::size_t>(S, 1);
+        std::size_t k = lv.k;
+        if (W > lv.k * S) {
+            lv.pivot_early_exits++;
+            k = std::max<std::size_t>(std::min<std::size_t>(2, k_max), lv.k / 2);
+        } else if (2 * P <= S) {
+            k = std::min(k_max, 2 * lv.k);
+        }
+        if (k != lv.k) lv.k_changes++;
+        lv.k = k;
+    }
+
+    void after_subcall(int l, std::size_t M_max, std::size_t pulled, bool partial) {
+        Level& lv = level(l);
+        lv.pulls++;
+        lv.pulled += pulled;
+        std::size_t M = lv.M;
+        if (partial) {
+            lv.partial_subcalls++;
+            M = std::max<std::size_t>(1, lv.M / 2);
+        } else if (pulled >= lv.M) {
+            M = M_max / 2 < lv.M ? M_max : 2 * lv.M;
+        }
+        if (M != lv.M) lv.M_changes++;
+        lv.M = M;
+    }
+
+private:
+    std::vector<Level> levels_;
+
+    Level& level(int l) {
+        const std::size_t i = (std::size_t)std::max(l, 0);
+        if (levels_.size() <= i) levels_.resize(i + 1);
+        return levels_[i];
+    }
+};
+
 class BMSSP {
 public:
-    static BMSSPResult run(const Graph& G, int l, Weight B, const std::vector<Vertex>& S, DistState& state, std::size_t k, std::size_t t) {
+    // Recursion depth for a top-level call on n vertices: l = ceil(log2(n) / t),
+    // so the size cap k 2^{lt} >= n and the top call is never cut short.
+    static int top_level(std::size_t n, std::size_t t) {
+        const double levels = std::log2((double)std::max<std::size_t>(n, 2)) / (double)std::max<std::size_t>(t, 1);
+        return std::max(1, (int)std::ceil(levels));
+    }
+
+    // Frames that can settle at most the cutoff many vertices, min(k 2^{lt}, n),
+    // run as one bounded Dijkstra (BaseCase with that budget) instead of
+    // FindPivots, the block structure and recursion. The budget keeps the
+    // frame's contract, so larger frames are unaffected. Used when
+    // BMSSPParams::dijkstra_cutoff is 0; sssp_autotune measures a better
+    // value per graph family and stores it in the tuning file.
+    static constexpr std::size_t kDefaultDijkstraCutoff = 4096;
+
+    // One frame with explicit l, k and t: l is used as given, so a frame too
+    // shallow for its sources returns B' < B; every level above 0 recurses.
+    static BMSSPResult run(const Graph& G, int l, Weight B, const std::vector<Vertex>& S, DistState& state, std::size_t k, std::size_t t,
+                           EdgeDirection dir = EdgeDirection::Outgoing) {
+        BMSSPParams p;
+        p.k = k;
+        p.t = t;
+        p.l = l;
+        p.dijkstra_cutoff = 1;
+        return run_frame(G, l, B, S, state, p, dir, nullptr);
+    }
+
+    // Fills the zero fields of p for a graph with n vertices. An explicit l
+    // below top_level(n, t) is raised to it: a shallower top frame hits its
+    // size cap k 2^{lt} < n and returns with vertices left incomplete.
+    static BMSSPParams resolve(const BMSSPParams& p, std::size_t n) {
+        BMSSPParams r = p;
+        if (r.k == 0) r.k = compute_k(n);
+        if (r.t == 0) r.t = compute_t(n);
+        r.l = std::max(r.l, top_level(n, r.t));
+        if (r.dijkstra_cutoff == 0) r.dijkstra_cutoff = kDefaultDijkstraCutoff;
+        return r;
+    }
+
+    // Top-level call with explicit parameters (zero fields derived from G)
+    // With params.adaptive, a fresh FrameTuner adapts k and M per frame.
+    static BMSSPResult run(const Graph& G, const BMSSPParams& params, Weight B, const std::vector<Vertex>& S,
+                           DistState& state, EdgeDirection dir = EdgeDirection::Outgoing) {
+        FrameTuner tuner;
+        const BMSSPParams p = resolve(params, G.num_vertices());
+        return run_frame(G, p.l, B, S, state, p, dir, p.adaptive ? &tuner : nullptr);
+    }
+
+    // Adaptive run with a caller-owned tuner, whose statistics (and choices)
+    // carry over between calls; params.adaptive is implied.
+    static BMSSPResult run(const Graph& G, const BMSSPParams& params, Weight B, const std::vector<Vertex>& S,
+                           DistState& state, FrameTuner& tuner, EdgeDirection dir = EdgeDirection::Outgoing) {
+        const BMSSPParams p = resolve(params, G.num_vertices());
+        return run_frame(G, p.l, B, S, state, p, dir, &tuner);
+    }
+
+private:
+    // 2^e, saturating instead of overflowing the shift
+    static std::size_t pow2(std::size_t e) {
+        return e >= std::numeric_limits<std::size_t>::digits - 1 ? std::numeric_limits<std::size_t>::max() / 2
+                                                                  : (std::size_t)1 << e;
+    }
+
+    static std::size_t saturating_mul(std::size_t a, std::size_t b) {
+        return b != 0 && a > std::numeric_limits<std::size_t>::max() / b ? std::numeric_limits<std::size_t>::max()
+                                                                        : a * b;
+    }
+
+    // p is resolved: no zero fields except block_size (derived per level)
+    static BMSSPResult run_frame(const Graph& G, int l, Weight B, const std::vector<Vertex>& S, DistState& state,
+                                 const BMSSPParams& p, EdgeDirection dir, FrameTuner* tuner) {
+        const std::size_t k = p.k, t = p.t;
 #ifdef SSSP_PROFILE
         ScopeTimer timer(&prof().bmssp_ns);
+        prof().bmssp_calls++;
 #endif
         BMSSPResult res{B, {}};
         if (S.empty()) return res;
 
-
-
         if (l <= 0) {
-            BaseCaseResult bc = BaseCase::run(G, B, S.front(), state, k);
+            BaseCaseResult bc = BaseCase::run(G, B, S, state, k, dir);
             res.B_prime = bc.B_prime;
             res.U = std::move(bc.U);
             return res;
         }
+        const std::size_t frame_bound = saturating_mul(k, pow2((std::size_t)l * t));
+        const std::size_t reachable = std::min<std::size_t>(frame_bound, G.num_vertices());
+        if (reachable <= p.dijkstra_cutoff) {
+#ifdef SSSP_PROFILE
+            prof().dijkstra_frames++;
+#endif
+            // Budget per seed rounded up, so k|S| + 1 covers the whole frame
+            const std::size_t per_seed = std::max<std::size_t>(1, reachable / S.size() + (reachable % S.size() != 0));
+            BaseCaseResult bc = BaseCase::run(G, B, S, state, per_seed, dir);
+            res.B_prime = bc.B_prime;
+            res.U = std::move(bc.U);
+            return res;
+        }
+        const std::size_t M_max = p.block_size != 0 ? p.block_size : pow2((std::size_t)(l - 1) * t);
+        std::size_t rounds = k, M = M_max;
+        if (tuner) std::tie(rounds, M) = tuner->begin_frame(l, k, M_max);
         std::unordered_set<Vertex> Sset(S.begin(), S.end());
-        auto piv = FindPivots::execute(G, B, Sset, k, state);
+        auto piv = FindPivots::execute(G, B, Sset, rounds, state, dir, p.pivots);
+        if (tuner) tuner->after_pivots(l, k, Sset.size(), piv.P.size(), piv.W.size());
         std::vector<Vertex> P(piv.P.begin(), piv.P.end());
         std::vector<Vertex> W(piv.W.begin(), piv.W.end());
-        std::size_t M = (std::size_t)1 << ((l - 1) * (int)t);
-
-
 
         BlockDataStructure D;
         D.Initialize(M, B);
-        for (auto p : P) {
-            Weight val = state.get(p.id());
-            if (val < B) D.Insert(p, val);
+        for (const auto& x : P) {
+            const Weight dx = state.get(x.id());
+            if (dx < B) D.Insert(x, dx);
         }
         std::unordered_set<Vertex> Uset;
         Weight current_Bp = B;
         std::vector<Vertex> Si;
-        Si.reserve(M);
+        Si.reserve(std::min<std::size_t>(M, P.size()));
         std::vector<BlockDataStructure::KeyValuePair> Kbuf;
         Kbuf.reserve(16);
 
         while (!D.empty()) {
-
             auto pulled = D.Pull();
+#ifdef SSSP_PROFILE
+            prof().pulls++;
+#endif
+            // A vertex can still sit in D under an older, larger value after an
+            // earlier sub-call completed it; its edges are relaxed already.
             Si.clear();
             Si.reserve(pulled.first.size());
-            for (auto& kv : pulled.first) Si.push_back(kv.first);
+            for (auto& kv : pulled.first) {
+                if (Uset.find(kv.first) == Uset.end()) Si.push_back(kv.first);
+            }
             Weight Bi = pulled.second;
 
-                        if (Si.empty()) break;
-            BMSSPResult sub = run(G, l - 1, Bi, Si, state, k, t);
-            current_Bp = std::min(current_Bp, sub.B_prime);
-
-
+            if (Si.empty()) continue;
+            BMSSPResult sub = run_frame(G, l - 1, Bi, Si, state, p, dir, tuner);
+            // Pull boundaries only grow, so the last sub-call's B'_i bounds U
+            current_Bp = sub.B_prime;
+            if (tuner) tuner->after_subcall(l, M_max, Si.size(), sub.B_prime < Bi);
 
+            // Relax edges out of the newly completed vertices: values in [Bi, B)
+            // go to D, values in [B'_i, Bi) are batch-prepended together with the
+            // incomplete part of Si. Values below B'_i belong to complete vertices
+            // and must not be re-queued, otherwise D never drains on cyclic graphs.
+            Kbuf.clear();
             for (auto u : sub.U) {
                 if (Uset.insert(u).second) res.U.push_back(u);
-                for (const auto& e : G.get_outgoing_edges(u)) {
-                    const Vertex v = e.destination();
+                for (const auto& e : G.get_edges(u, dir)) {
+                    const Vertex v = Graph::far_end(e, dir);
                     const Weight alt = state.get(u.id()) + e.weight();
                     const Weight dv = state.get(v.id());
-                    if (alt < B && alt <= dv) {
-                        const bool better = alt < dv;
-                        if (better || alt == dv) {
-                            if (better) state.set(v.id(), alt);
+                    if (alt <= dv) {
+                        if (alt < dv) {
+                            state.set(v.id(), alt);
                             state.set_pred(v.id(), u.id());
                         }
-                        D.Insert(v, alt);
-                    } else if (alt >= current_Bp && alt < Bi) {
-                        Kbuf.clear();
-                        Kbuf.emplace_back(v, alt);
-                        D.BatchPrepend(Kbuf);
+                        if (alt >= Bi && alt < B) {
+                            D.Insert(v, alt);
+                        } else if (alt >= sub.B_prime && alt < Bi) {
+                            Kbuf.emplace_back(v, alt);
+                        }
                     }
                 }
             }
+            for (auto x : Si) {
+                const Weight dx = state.get(x.id());
+                if (dx >= sub.B_prime && dx < Bi) Kbuf.emplace_back(x, dx);
+            }
+            D.BatchPrepend(Kbuf);
 
-                        if (Uset.size() > k * ((std::size_t)1 << (l * t))) break;
+            if (Uset.size() > frame_bound) break;
         }
+        // A drained D leaves everything below B complete, otherwise B' = B'_i
+        if (D.empty()) current_Bp = B;
+        // Only the part of W below B' is complete (U = U_i + {x in W : d(x) < B'})
         for (auto w : W) {
-            if (Uset.insert(w).second) res.U.push_back(w);
+            if (state.get(w.id()) < current_Bp && Uset.insert(w).second) res.U.push_back(w);
         }
         res.B_prime = current_Bp;
-
-
         return res;
     }
 };
@@ -0,0 +1,279 @@
+#ifndef SSSP_CENTRALITY_HPP
+#define SSSP_CENTRALITY_HPP
+
+#include "sssp/types.hpp"
+#include "sssp/graph.hpp"
+#include "sssp/binary_heap.hpp"
+#include "sssp/parallel.hpp"
+#include <vector>
+#include <random>
+#include <numeric>
+#include <cstdint>
+#include <algorithm>
+
+namespace sssp {
+
+struct CentralityOptions {
+    std::size_t num_threads = 0;      // 0 = hardware concurrency
+    std::size_t sample_sources = 0;   // 0 = exact (every vertex is a source)
+    std::uint64_t seed = 42;          // source sampling seed
+};
+
+struct ClosenessScores {
+    std::vector<double> closeness;   // Wasserman-Faust: (r-1)/(n-1) * (r-1)/sum_u d(v, u)
+    std::vector<double> harmonic;    // sum_{u != v} 1/d(v, u), divided by n-1
+    std::size_t sources = 0;         // single-source searches run
+};
+
+namespace detail {
+
+/**
+ * @brief Flat adjacency of one direction for the centrality searches
+ */
+struct CentralityCSR {
+    std::vector<std::size_t> offsets;
+    std::vector<VertexId> heads;
+    std::vector<Weight> weights;
+
+    CentralityCSR(const Graph& G, EdgeDirection dir) {
+        const std::size_t n = G.num_vertices();
+        offsets.assign(n + 1, 0);
+        heads.reserve(G.num_edges());
+        weights.reserve(G.num_edges());
+        for (VertexId u = 0; u < n; ++u) {
+            for (const auto& e : G.get_edges(Vertex(u), dir)) {
+                heads.push_back(Graph::far_end(e, dir).id());
+                weights.push_back(e.weight());
+            }
+            offsets[u + 1] = heads.size();
+        }
+    }
+};
+
+/**
+ * @brief Per-thread search state and accumulators
+ *
+ * dist/sigma/delta are reset sparsely through order, which lists every
+ * vertex the last search reached in non-decreasing distance.
+ */
+struct CentralityWorkspace {
+    std::vector<Weight> dist;
+    std::vector<double> sigma;     // shortest-path counts
+    std::vector<double> delta;     // Brandes dependencies
+    std::vector<VertexId> order;
+    BinaryHeap heap;
+    std::vector<double> acc[3];    // per-thread accumulators, reduced at the end
+
+    void fit(std::size_t n, std::size_t accumulators) {
+        if (dist.size() == n) return;
+        dist.assign(n, INFINITE_WEIGHT);
+        sigma.assign(n, 0.0);
+        delta.assign(n, 0.0);
+        for (std::size_t i = 0; i < accumulators; ++i) acc[i].assign(n, 0.0);
+    }
+
+    void reset() {
+        for (VertexId v : order) {
+            dist[v] = INFINITE_WEIGHT;
+            sigma[v] = 0.0;
+            delta[v] = 0.0;
+        }
+        order.clear();
+        heap.clear();
+    }
+};
+
+// Single-source search filling ws.order, ws.dist and ws.sigma. With unit
+// weights order doubles as the BFS queue; otherwise Dijkstra.
+inline void centrality_search(const CentralityCSR& g, VertexId s, bool unit, CentralityWorkspace& ws) {
+    ws.dist[s] = 0.0;
+    ws.sigma[s] = 1.0;
+    if (unit) {
+        ws.order.push_back(s);
+        for (std::size_t head = 0; head < ws.order.size(); ++head) {
+            const VertexId u = ws.order[head];
+            for (std::size_t a = g.offsets[u]; a < g.offsets[u + 1]; ++a) {
+                const VertexId v = g.heads[a];
+                if (ws.dist[v] == INFINITE_WEIGHT) {
+                    ws.dist[v] = ws.dist[u] + 1.0;
+                    ws.order.push_back(v);
+                }
+                if (ws.dist[v] == ws.dist[u] + 1.0) ws.sigma[v] += ws.sigma[u];
+            }
+        }
+        return;
+    }
+    ws.heap.insert(Vertex(s), 0.0);
+    while (!ws.heap.empty()) {
+        auto [u, du] = ws.heap.extract_min();
+        ws.order.push_back(u.id());
+        for (std::size_t a = g.offsets[u.id()]; a < g.offsets[u.id() + 1]; ++a) {
+            const VertexId v = g.heads[a];
+            const Weight alt = du + g.weights[a];
+            if (alt < ws.dist[v]) {
+                ws.dist[v] = alt;
+                ws.sigma[v] = ws.sigma[u.id()];
+                ws.heap.insert(Vertex(v), alt);
+            } else if (alt == ws.dist[v]) {
+                ws.sigma[v] += ws.sigma[u.id()];
+            }
+        }
+    }
+}
+
+// Sources to run: all vertices, or `budget` distinct ones drawn uniformly
+inline std::vector<VertexId> centrality_sources(std::size_t n, const CentralityOptions& opts) {
+    std::vector<VertexId> sources(n);
+    std::iota(sources.begin(), sources.end(), VertexId(0));
+    if (opts.sample_sources == 0 || opts.sample_sources >= n) return sources;
+    std::mt19937_64 rng(opts.seed);
+    for (std::size_t i = 0; i < opts.sample_sources; ++i) {
+        std::uniform_int_distribution<std::size_t> pick(i, n - 1);
+        std::swap(sources[i], sources[pick(rng)]);
+    }
+    sources.resize(opts.sample_sources);
+    return sources;
+}
+
+// out[v] = sum over threads of ws.acc[slot][v], reduced in parallel by vertex
+inline std::vector<double> reduce_accumulators(std::vector<CentralityWorkspace>& workspaces, std::size_t slot,
+                                               std::size_t n, std::size_t threads) {
+    std::vector<double> out(n, 0.0);
+    constexpr std::size_t CHUNK = 4096;
+    parallel_for((n + CHUNK - 1) / CHUNK, threads, [&](std::size_t c, std::size_t) {
+        const std::size_t lo = c * CHUNK, hi = std::min(n, lo + CHUNK);
+        for (const auto& ws : workspaces) {
+            if (ws.acc[slot].empty()) continue;   // thread never ran
+            for (std::size_t v = lo; v < hi; ++v) out[v] += ws.acc[slot][v];
+        }
+    });
+    return out;
+}
+
+} // namespace detail
+
+/**
+ * @brief Closeness and harmonic centrality from distance sums
+ *
+ * Both need sum_u d(v, u) and sum_u 1/d(v, u) for every v. Each source
+ * (pivot) p runs one search over incoming edges, which yields d(v, p) for
+ * all v at once, and adds it to v's sums. Exact mode uses every vertex as
+ * a pivot. With sample_sources = k, k pivots are drawn uniformly and the
+ * sums and reach counts are scaled by (n-1)/k' (k' = pivots other than v),
+ * the Eppstein-Wang estimator.
+ *
+ * Pivots run in parallel, one workspace and set of accumulators per thread,
+ * summed at the end. Unit-weight graphs use BFS instead of Dijkstra.
+ */
+inline ClosenessScores closenessCentrality(const Graph& G, const CentralityOptions& opts = CentralityOptions()) {
+    const std::size_t n = G.num_vertices();
+    ClosenessScores res;
+    res.closeness.assign(n, 0.0);
+    res.harmonic.assign(n, 0.0);
+    if (n < 2) return res;
+
+    const detail::CentralityCSR in(G, EdgeDirection::Incoming);
+    const bool unit = G.has_uniform_weights();
+    const double unit_weight = unit ? G.uniform_weight() : 1.0;
+    const auto sources = detail::centrality_sources(n, opts);
+    const std::size_t threads = resolve_threads(opts.num_threads);
+    std::vector<detail::CentralityWorkspace> workspaces(threads);
+    std::vector<char> is_source(n, 0);
+    for (VertexId p : sources) is_source[p] = 1;
+
+    enum { SUM = 0, INV_SUM = 1, REACH = 2 };
+    parallel_for(sources.size(), threads, [&](std::size_t i, std::size_t tid) {
+        auto& ws = workspaces[tid];
+        ws.fit(n, 3);
+        const VertexId p = sources[i];
+        detail::centrality_search(in, p, unit, ws);
+        for (VertexId v : ws.order) {
+            if (v == p) continue;
+            const double d = unit ? ws.dist[v] * unit_weight : ws.dist[v];
+            ws.acc[SUM][v] += d;
+            ws.acc[INV_SUM][v] += d > 0.0 ? 1.0 / d : 0.0;
+            ws.acc[REACH][v] += 1.0;
+        }
+        ws.reset();
+    });
+    res.sources = sources.size();
+
+    const auto sum = detail::reduce_accumulators(workspaces, SUM, n, threads);
+    const auto inv_sum = detail::reduce_accumulators(workspaces, INV_SUM, n, threads);
+    const auto reach = detail::reduce_accumulators(workspaces, REACH, n, threads);
+    const double others = static_cast<double>(n - 1);
+    for (VertexId v = 0; v < n; ++v) {
+        const double pivots = static_cast<double>(sources.size() - is_source[v]);
+        if (pivots == 0.0) continue;
+        const double scale = others / pivots;
+        const double reached = reach[v] * scale;   // estimate of r - 1
+        if (sum[v] > 0.0) res.closeness[v] = (reached / others) * (reached / (sum[v] * scale));
+        res.harmonic[v] = inv_sum[v] * scale / others;
+    }
+    return res;
+}
+
+/**
+ * @brief Harmonic centrality only; see closenessCentrality
+ */
+inline std::vector<double> harmonicCentrality(const Graph& G, const CentralityOptions& opts = CentralityOptions()) {
+    return closenessCentrality(G, opts).harmonic;
+}
+
+/**
+ * @brief Betweenness centrality (Brandes)
+ *
+ * For every source s a search computes distances and shortest-path counts
+ * sigma, then dependencies are accumulated in reverse settle order:
+ * delta(v) += sigma(v)/sigma(w) * (1 + delta(w)) over tight edges v -> w.
+ * Tight edges are found by scanning incoming edges, so no predecessor
+ * lists are stored. Returns the raw sum over ordered pairs (s, t) of the
+ * fraction of shortest s-t paths through v; divide by (n-1)(n-2) to
+ * normalize.
+ *
+ * With sample_sources = k the sum runs over k uniform sources and is scaled
+ * by n/k (Brandes-Pich), an unbiased estimate at k searches instead of n.
+ * Sources run in parallel with per-thread workspaces and accumulators.
+ * Path counting assumes positive edge weights; equal-length paths are
+ * detected by exact comparison of distances.
+ */
+inline std::vector<double> betweennessCentrality(const Graph& G, const CentralityOptions& opts = CentralityOptions()) {
+    const std::size_t n = G.num_vertices();
+    if (n < 3) return std::vector<double>(n, 0.0);
+
+    const detail::CentralityCSR out(G, EdgeDirection::Outgoing);
+    const detail::CentralityCSR in(G, EdgeDirection::Incoming);
+    const bool unit = G.has_uniform_weights();
+    const auto sources = detail::centrality_sources(n, opts);
+    const std::size_t threads = resolve_threads(opts.num_threads);
+    std::vector<detail::CentralityWorkspace> workspaces(threads);
+
+    parallel_for(sources.size(), threads, [&](std::size_t i, std::size_t tid) {
+        auto& ws = workspaces[tid];
+        ws.fit(n, 1);
+        const VertexId s = sources[i];
+        detail::centrality_search(out, s, unit, ws);
+        for (auto it = ws.order.rbegin(); it != ws.order.rend(); ++it) {
+            const VertexId w = *it;
+            const double coeff = (1.0 + ws.delta[w]) / ws.sigma[w];
+            for (std::size_t a = in.offsets[w]; a < in.offsets[w + 1]; ++a) {
+                const VertexId v = in.heads[a];
+                const Weight step = unit ? 1.0 : in.weights[a];
+                if (ws.dist[v] + step == ws.dist[w]) ws.delta[v] += ws.sigma[v] * coeff;
+            }
+            if (w != s) ws.acc[0][w] += ws.delta[w];
+        }
+        ws.reset();
+    });
+
+    auto scores = detail::reduce_accumulators(workspaces, 0, n, threads);
+    if (sources.size() < n) {
+        const double scale = static_cast<double>(n) / static_cast<double>(sources.size());
+        for (auto& x : scores) x *= scale;
+    }
+    return scores;
+}
+
+} // namespace sssp
+
+#endif // SSSP_CENTRALITY_HPP
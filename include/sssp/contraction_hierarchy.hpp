@@ -0,0 +1,502 @@
+#ifndef SSSP_CONTRACTION_HIERARCHY_HPP
+#define SSSP_CONTRACTION_HIERARCHY_HPP
+
+#include "sssp/types.hpp"
+#include "sssp/graph.hpp"
+#include "sssp/binary_heap.hpp"
+#include "sssp/parallel.hpp"
+#include <vector>
+#include <string>
+#include <fstream>
+#include <cstdint>
+#include <cstring>
+#include <algorithm>
+#include <stdexcept>
+
+namespace sssp {
+
+struct CHBuildOptions {
+    std::size_t num_threads = 0;              // 0 = hardware concurrency
+    std::size_t witness_settle_limit = 200;   // vertices settled per witness search
+};
+
+struct CHQueryResult {
+    Weight distance;
+    std::vector<Vertex> path;   // unpacked to original edges; empty if unreachable
+    std::size_t settled;        // vertices settled by both upward searches
+};
+
+/**
+ * @brief Contraction Hierarchies for static point-to-point queries
+ *
+ * Preprocessing contracts vertices in order of increasing priority
+ * (twice the edge difference, plus the number of already contracted
+ * neighbours, plus the hierarchy depth reached so far). Contracting
+ * v inserts a shortcut u -> w for every pair of remaining neighbours unless a
+ * witness search finds a path of at most the same length avoiding v.
+ * Each round contracts an independent set of vertices that are local
+ * priority minima; their witness searches run in parallel and ignore every
+ * vertex of the round, which keeps simultaneous contraction exact.
+ *
+ * The result is stored as two upward CSR arrays per vertex:
+ * - up_out: edges v -> w with rank(w) > rank(v)  (forward search)
+ * - up_in:  edges w -> v with rank(w) > rank(v)  (backward search)
+ * Each edge records the contracted middle vertex so paths can be unpacked.
+ *
+ * Vertex ids are assumed dense in [0, n), as for DistState.
+ */
+class ContractionHierarchy {
+public:
+    struct Arc {
+        VertexId other;     // head for up_out, tail for up_in
+        Weight weight;
+        VertexId middle;    // INVALID_VERTEX for original edges
+    };
+
+    static ContractionHierarchy build(const Graph& G, const CHBuildOptions& opts = CHBuildOptions()) {
+        const std::size_t n = G.num_vertices();
+        ContractionHierarchy ch;
+        ch.n_ = n;
+        ch.rank_.assign(n, 0);
+
+        Builder b(n, resolve_threads(opts.num_threads), opts.witness_settle_limit);
+        for (const auto& e : G.edges()) {
+            if (e.source() == e.destination()) continue;
+            b.add_arc(e.source().id(), e.destination().id(), e.weight(), INVALID_VERTEX);
+        }
+
+        std::vector<std::vector<Arc>> up_out(n), up_in(n);
+        std::vector<VertexId> remaining(n);
+        for (VertexId v = 0; v < n; ++v) remaining[v] = v;
+        b.update_priorities(remaining);
+
+        std::size_t next_rank = 0;
+        std::vector<VertexId> batch, affected;
+        std::vector<std::vector<Shortcut>> shortcuts;
+        while (!remaining.empty()) {
+            // Independent set of local minima w.r.t. (priority, id)
+            batch.clear();
+            for (VertexId v : remaining) {
+                if (b.is_local_minimum(v)) batch.push_back(v);
+            }
+            for (VertexId v : batch) b.in_batch[v] = 1;
+
+            shortcuts.assign(batch.size(), {});
+            parallel_for(batch.size(), b.threads, [&](std::size_t i, std::size_t tid) {
+                b.find_shortcuts(batch[i], b.workspaces[tid], shortcuts[i]);
+            });
+
+            affected.clear();
+            for (std::size_t i = 0; i < batch.size(); ++i) {
+                const VertexId v = batch[i];
+                for (const auto& a : b.out[v]) {
+                    if (b.contracted[a.other]) continue;
+                    up_out[v].push_back(a);
+                    affected.push_back(a.other);
+                }
+                for (const auto& a : b.in[v]) {
+                    if (b.contracted[a.other]) continue;
+                    up_in[v].push_back(a);
+                    affected.push_back(a.other);
+                }
+                ch.rank_[v] = next_rank++;
+                b.contracted[v] = 1;
+                b.in_batch[v] = 0;
+            }
+            for (VertexId v : batch) b.detach(v);
+            for (std::size_t i = 0; i < batch.size(); ++i) {
+                for (const auto& s : shortcuts[i]) b.add_arc(s.from, s.to, s.weight, batch[i]);
+                ch.num_shortcuts_ += shortcuts[i].size();
+            }
+
+            std::sort(affected.begin(), affected.end());
+            affected.erase(std::unique(affected.begin(), affected.end()), affected.end());
+            for (VertexId x : affected) b.contracted_neighbors[x]++;
+            b.update_priorities(affected);
+
+            remaining.erase(std::remove_if(remaining.begin(), remaining.end(),
+                                           [&](VertexId v) { return b.contracted[v] != 0; }),
+                            remaining.end());
+        }
+
+        flatten(up_out, ch.up_out_offsets_, ch.up_out_);
+        flatten(up_in, ch.up_in_offsets_, ch.up_in_);
+        return ch;
+    }
+
+    /**
+     * @brief Bidirectional upward search with stall-on-demand
+     *
+     * The forward search relaxes only up_out, the backward search only
+     * up_in. A vertex is stalled (not expanded) when a higher-ranked
+     * neighbour already proves its tentative distance suboptimal.
+     */
+    CHQueryResult query(const Vertex& source, const Vertex& target) const {
+        CHQueryResult res{INFINITE_WEIGHT, {}, 0};
+        if (source.id() >= n_ || target.id() >= n_) return res;
+        if (source == target) {
+            res.distance = 0.0;
+            res.path.push_back(source);
+            return res;
+        }
+
+        thread_local QueryWorkspace ws;
+        ws.prepare(n_);
+        const VertexId s = source.id(), t = target.id();
+        ws.touch(s);
+        ws.touch(t);
+        ws.dist[0][s] = 0.0;
+        ws.dist[1][t] = 0.0;
+        ws.heap[0].insert(source, 0.0);
+        ws.heap[1].insert(target, 0.0);
+
+        Weight mu = INFINITE_WEIGHT;
+        VertexId meet = INVALID_VERTEX;
+        int side = 0;
+        while (!ws.heap[0].empty() || !ws.heap[1].empty()) {
+            const bool f_open = !ws.heap[0].empty() && ws.heap[0].peek_min().second < mu;
+            const bool b_open = !ws.heap[1].empty() && ws.heap[1].peek_min().second < mu;
+            if (!f_open && !b_open) break;
+            if (!f_open) side = 1;
+            else if (!b_open) side = 0;
+
+            const int other = 1 - side;
+            auto [uv, du] = ws.heap[side].extract_min();
+            const VertexId u = uv.id();
+            res.settled++;
+
+            if (ws.dist[other][u] < INFINITE_WEIGHT && du + ws.dist[other][u] < mu) {
+                mu = du + ws.dist[other][u];
+                meet = u;
+            }
+
+            // Forward search moves along up_out and stalls via up_in; the
+            // backward search does the opposite.
+            const auto& step_off = side == 0 ? up_out_offsets_ : up_in_offsets_;
+            const auto& step_arc = side == 0 ? up_out_ : up_in_;
+            const auto& stall_off = side == 0 ? up_in_offsets_ : up_out_offsets_;
+            const auto& stall_arc = side == 0 ? up_in_ : up_out_;
+
+            bool stalled = false;
+            for (std::size_t i = stall_off[u]; i < stall_off[u + 1]; ++i) {
+                const Arc& a = stall_arc[i];
+                if (ws.dist[side][a.other] + a.weight < du) { stalled = true; break; }
+            }
+            if (!stalled) {
+                for (std::size_t i = step_off[u]; i < step_off[u + 1]; ++i) {
+                    const Arc& a = step_arc[i];
+                    const Weight alt = du + a.weight;
+                    if (alt < ws.dist[side][a.other]) {
+                        ws.touch(a.other);
+                        ws.dist[side][a.other] = alt;
+                        ws.parent[side][a.other] = u;
+                        ws.heap[side].insert(Vertex(a.other), alt);
+                    }
+                }
+            }
+            side = other;
+        }
+
+        if (meet == INVALID_VERTEX) return res;
+        res.distance = mu;
+
+        // Hierarchy path s ... meet ... t, then unpack every shortcut
+        std::vector<VertexId> up;
+        for (VertexId v = meet; v != INVALID_VERTEX; v = ws.parent[0][v]) up.push_back(v);
+        std::reverse(up.begin(), up.end());
+        for (VertexId v = ws.parent[1][meet]; v != INVALID_VERTEX; v = ws.parent[1][v]) up.push_back(v);
+
+        res.path.push_back(Vertex(up.front()));
+        for (std::size_t i = 0; i + 1 < up.size(); ++i) unpack(up[i], up[i + 1], res.path);
+        return res;
+    }
+
+    /**
+     * @brief Persist the augmented graph (ranks and upward CSR arrays)
+     */
+    void save(const std::string& path) const {
+        std::ofstream out(path, std::ios::binary);
+        if (!out) throw std::runtime_error("Cannot open CH file for writing: " + path);
+        const std::uint64_t header[4] = {FORMAT_VERSION, n_, up_out_.size(), up_in_.size()};
+        out.write(MAGIC, sizeof(MAGIC));
+        out.write(reinterpret_cast<const char*>(header), sizeof(header));
+        out.write(reinterpret_cast<const char*>(&num_shortcuts_), sizeof(num_shortcuts_));
+        write_vector(out, rank_);
+        write_vector(out, up_out_offsets_);
+        write_vector(out, up_out_);
+        write_vector(out, up_in_offsets_);
+        write_vector(out, up_in_);
+        if (!out) throw std::runtime_error("Failed to write CH file: " + path);
+    }
+
+    static ContractionHierarchy load(const std::string& path) {
+        std::ifstream in(path, std::ios::binary);
+        if (!in) throw std::runtime_error("Cannot open CH file: " + path);
+        char magic[sizeof(MAGIC)];
+        std::uint64_t header[4];
+        in.read(magic, sizeof(magic));
+        in.read(reinterpret_cast<char*>(header), sizeof(header));
+        if (!in || std::memcmp(magic, MAGIC, sizeof(MAGIC)) != 0 || header[0] != FORMAT_VERSION) {
+            throw std::runtime_error("Not a CH file: " + path);
+        }
+        ContractionHierarchy ch;
+        ch.n_ = header[1];
+        in.read(reinterpret_cast<char*>(&ch.num_shortcuts_), sizeof(ch.num_shortcuts_));
+        read_vector(in, ch.rank_, ch.n_);
+        read_vector(in, ch.up_out_offsets_, ch.n_ + 1);
+        read_vector(in, ch.up_out_, header[2]);
+        read_vector(in, ch.up_in_offsets_, ch.n_ + 1);
+        read_vector(in, ch.up_in_, header[3]);
+        if (!in) throw std::runtime_error("Truncated CH file: " + path);
+        return ch;
+    }
+
+    [[nodiscard]] std::size_t num_vertices() const noexcept { return n_; }
+    [[nodiscard]] std::size_t num_shortcuts() const noexcept { return num_shortcuts_; }
+    [[nodiscard]] std::size_t num_arcs() const noexcept { return up_out_.size() + up_in_.size(); }
+    [[nodiscard]] std::size_t rank(VertexId v) const { return rank_[v]; }
+    [[nodiscard]] const std::vector<std::size_t>& ranks() const noexcept { return rank_; }
+
+private:
+    static constexpr char MAGIC[8] = {'S', 'S', 'S', 'P', 'C', 'H', '\0', '\0'};
+    static constexpr std::uint64_t FORMAT_VERSION = 1;
+
+    std::size_t n_ = 0;
+    std::uint64_t num_shortcuts_ = 0;
+    std::vector<std::size_t> rank_;
+    std::vector<std::size_t> up_out_offsets_{0};
+    std::vector<Arc> up_out_;
+    std::vector<std::size_t> up_in_offsets_{0};
+    std::vector<Arc> up_in_;
+
+    struct Shortcut {
+        VertexId from;
+        VertexId to;
+        Weight weight;
+    };
+
+    /**
+     * @brief Local Dijkstra used for witness searches, reset sparsely
+     */
+    struct WitnessWorkspace {
+        std::vector<Weight> dist;
+        std::vector<VertexId> touched;
+        BinaryHeap heap;
+    };
+
+    /**
+     * @brief Mutable overlay graph and bookkeeping used during contraction
+     */
+    struct Builder {
+        std::vector<std::vector<Arc>> out, in;
+        std::vector<char> contracted, in_batch;
+        std::vector<std::size_t> contracted_neighbors;
+        std::vector<long long> priority;
+        std::vector<std::size_t> depth;
+        std::vector<WitnessWorkspace> workspaces;
+        std::size_t threads;
+        std::size_t settle_limit;
+
+        Builder(std::size_t n, std::size_t num_threads, std::size_t limit)
+            : out(n), in(n), contracted(n, 0), in_batch(n, 0),
+              contracted_neighbors(n, 0), priority(n, 0), depth(n, 0),
+              workspaces(num_threads), threads(num_threads), settle_limit(limit) {
+            for (auto& ws : workspaces) ws.dist.assign(n, INFINITE_WEIGHT);
+        }
+
+        // Insert or shorten arc u -> w, keeping one arc per ordered pair
+        void add_arc(VertexId u, VertexId w, Weight weight, VertexId middle) {
+            for (auto& a : out[u]) {
+                if (a.other != w) continue;
+                if (weight < a.weight) {
+                    a.weight = weight;
+                    a.middle = middle;
+                    for (auto& r : in[w]) {
+                        if (r.other == u) { r.weight = weight; r.middle = middle; break; }
+                    }
+                }
+                return;
+            }
+            out[u].push_back({w, weight, middle});
+            in[w].push_back({u, weight, middle});
+        }
+
+        // Drop the arcs of a contracted vertex from its neighbours' lists and
+        // push their depth below it
+        void detach(VertexId v) {
+            auto is_v = [v](const Arc& a) { return a.other == v; };
+            for (const auto& a : out[v]) {
+                auto& l = in[a.other];
+                l.erase(std::remove_if(l.begin(), l.end(), is_v), l.end());
+                depth[a.other] = std::max(depth[a.other], depth[v] + 1);
+            }
+            for (const auto& a : in[v]) {
+                auto& l = out[a.other];
+                l.erase(std::remove_if(l.begin(), l.end(), is_v), l.end());
+                depth[a.other] = std::max(depth[a.other], depth[v] + 1);
+            }
+        }
+
+        bool is_local_minimum(VertexId v) const {
+            auto beats = [&](VertexId x) {
+                return priority[v] < priority[x] || (priority[v] == priority[x] && v < x);
+            };
+            for (const auto& a : out[v]) {
+                if (!contracted[a.other] && !beats(a.other)) return false;
+            }
+            for (const auto& a : in[v]) {
+                if (!contracted[a.other] && !beats(a.other)) return false;
+            }
+            return true;
+        }
+
+        /**
+         * @brief Shortcuts required when contracting v
+         *
+         * One witness search per remaining in-neighbour u, bounded by the
+         * longest candidate through v and by settle_limit, skipping v, all
+         * contracted vertices and the vertices of the current round.
+         */
+        void find_shortcuts(VertexId v, WitnessWorkspace& ws, std::vector<Shortcut>& result) const {
+            result.clear();
+            for (const auto& in_arc : in[v]) {
+                const VertexId u = in_arc.other;
+                if (contracted[u] || in_batch[u]) continue;
+                Weight max_candidate = 0.0;
+                for (const auto& out_arc : out[v]) {
+                    if (out_arc.other == u || contracted[out_arc.other] || in_batch[out_arc.other]) continue;
+                    max_candidate = std::max(max_candidate, in_arc.weight + out_arc.weight);
+                }
+                witness_search(u, v, max_candidate, ws);
+                for (const auto& out_arc : out[v]) {
+                    const VertexId w = out_arc.other;
+                    if (w == u || contracted[w] || in_batch[w]) continue;
+                    const Weight candidate = in_arc.weight + out_arc.weight;
+                    if (ws.dist[w] > candidate) result.push_back({u, w, candidate});
+                }
+                for (VertexId x : ws.touched) ws.dist[x] = INFINITE_WEIGHT;
+                ws.touched.clear();
+            }
+        }
+
+        void witness_search(VertexId u, VertexId skip, Weight bound, WitnessWorkspace& ws) const {
+            ws.heap.clear();
+            ws.dist[u] = 0.0;
+            ws.touched.push_back(u);
+            ws.heap.insert(Vertex(u), 0.0);
+            std::size_t settled = 0;
+            while (!ws.heap.empty() && settled < settle_limit) {
+                auto [xv, dx] = ws.heap.extract_min();
+                if (dx > bound) break;
+                settled++;
+                for (const auto& a : out[xv.id()]) {
+                    const VertexId y = a.other;
+                    if (y == skip || contracted[y] || in_batch[y]) continue;
+                    const Weight alt = dx + a.weight;
+                    if (alt < ws.dist[y]) {
+                        if (ws.dist[y] == INFINITE_WEIGHT) ws.touched.push_back(y);
+                        ws.dist[y] = alt;
+                        ws.heap.insert(Vertex(y), alt);
+                    }
+                }
+            }
+        }
+
+        // priority = 2 * edge difference + contracted neighbours + depth
+        void update_priorities(const std::vector<VertexId>& vs) {
+            std::vector<std::vector<Shortcut>> scratch(threads);
+            parallel_for(vs.size(), threads, [&](std::size_t i, std::size_t tid) {
+                const VertexId v = vs[i];
+                find_shortcuts(v, workspaces[tid], scratch[tid]);
+                const long long removed = static_cast<long long>(out[v].size() + in[v].size());
+                priority[v] = 2 * (static_cast<long long>(scratch[tid].size()) - removed) +
+                              static_cast<long long>(contracted_neighbors[v]) +
+                              static_cast<long long>(depth[v]);
+            });
+        }
+    };
+
+    struct QueryWorkspace {
+        std::vector<Weight> dist[2];
+        std::vector<VertexId> parent[2];
+        std::vector<VertexId> touched;
+        BinaryHeap heap[2];
+
+        void prepare(std::size_t n) {
+            if (dist[0].size() != n) {
+                for (int s = 0; s < 2; ++s) {
+                    dist[s].assign(n, INFINITE_WEIGHT);
+                    parent[s].assign(n, INVALID_VERTEX);
+                }
+                touched.clear();
+            }
+            for (VertexId v : touched) {
+                for (int s = 0; s < 2; ++s) {
+                    dist[s][v] = INFINITE_WEIGHT;
+                    parent[s][v] = INVALID_VERTEX;
+                }
+            }
+            touched.clear();
+            heap[0].clear();
+            heap[1].clear();
+        }
+
+        void touch(VertexId v) {
+            if (dist[0][v] == INFINITE_WEIGHT && dist[1][v] == INFINITE_WEIGHT) touched.push_back(v);
+        }
+    };
+
+    static void flatten(const std::vector<std::vector<Arc>>& lists,
+                        std::vector<std::size_t>& offsets, std::vector<Arc>& arcs) {
+        offsets.assign(lists.size() + 1, 0);
+        for (std::size_t v = 0; v < lists.size(); ++v) offsets[v + 1] = offsets[v] + lists[v].size();
+        arcs.clear();
+        arcs.reserve(offsets.back());
+        for (const auto& l : lists) arcs.insert(arcs.end(), l.begin(), l.end());
+    }
+
+    // Hierarchy arc a -> b (either direction in rank)
+    const Arc* find_arc(VertexId a, VertexId b) const {
+        if (rank_[a] < rank_[b]) {
+            for (std::size_t i = up_out_offsets_[a]; i < up_out_offsets_[a + 1]; ++i) {
+                if (up_out_[i].other == b) return &up_out_[i];
+            }
+        } else {
+            for (std::size_t i = up_in_offsets_[b]; i < up_in_offsets_[b + 1]; ++i) {
+                if (up_in_[i].other == a) return &up_in_[i];
+            }
+        }
+        return nullptr;
+    }
+
+    // Append the original vertices of arc a -> b (excluding a) to path
+    void unpack(VertexId a, VertexId b, std::vector<Vertex>& path) const {
+        std::vector<std::pair<VertexId, VertexId>> stack = {{a, b}};
+        while (!stack.empty()) {
+            auto [x, y] = stack.back();
+            stack.pop_back();
+            const Arc* arc = find_arc(x, y);
+            if (arc == nullptr || arc->middle == INVALID_VERTEX) {
+                path.push_back(Vertex(y));
+                continue;
+            }
+            stack.push_back({arc->middle, y});
+            stack.push_back({x, arc->middle});
+        }
+    }
+
+    template <class T>
+    static void write_vector(std::ofstream& out, const std::vector<T>& v) {
+        out.write(reinterpret_cast<const char*>(v.data()), v.size() * sizeof(T));
+    }
+
+    template <class T>
+    static void read_vector(std::ifstream& in, std::vector<T>& v, std::size_t count) {
+        v.resize(count);
+        in.read(reinterpret_cast<char*>(v.data()), count * sizeof(T));
+    }
+};
+
+} // namespace sssp
+
+#endif // SSSP_CONTRACTION_HIERARCHY_HPP
@@ -0,0 +1,344 @@
+#ifndef SSSP_CRP_HPP
+#define SSSP_CRP_HPP
+
+#include "sssp/types.hpp"
+#include "sssp/graph.hpp"
+#include "sssp/binary_heap.hpp"
+#include "sssp/parallel.hpp"
+#include <vector>
+#include <cstdint>
+#include <limits>
+#include <algorithm>
+#include <stdexcept>
+
+namespace sssp {
+
+struct CRPOptions {
+    // Maximum number of vertices per cell, finest level first; must increase
+    std::vector<std::size_t> cell_sizes = {128, 4096};
+};
+
+struct CRPQueryResult {
+    Weight distance;
+    std::size_t settled;
+};
+
+/**
+ * @brief Customizable route planning (CRP) overlay
+ *
+ * Work is split into three phases:
+ * - preprocess(): metric-independent. Builds a nested multilevel partition
+ *   by BFS region growing (vertices at level 0, cells of the level below at
+ *   higher levels) and records the entry/exit vertices of every cell.
+ * - customize(): metric-dependent. Given a weight column indexed by EdgeId,
+ *   computes for every cell the clique of entry -> exit distances. Level 0
+ *   cells search original edges, higher levels search the cliques of their
+ *   subcells; cells of one level are customized in parallel.
+ * - query(): Dijkstra on the overlay. A vertex u is scanned at the highest
+ *   level whose cell contains neither s nor t, using that cell's clique and
+ *   the original edges leaving it; vertices sharing a level-0 cell with s or
+ *   t are scanned on original edges.
+ *
+ * A new weight column only requires customize() again; the partition and
+ * boundary sets stay valid as long as the topology is unchanged.
+ */
+class CRPOverlay {
+public:
+    static CRPOverlay preprocess(const Graph& G, const CRPOptions& opts = CRPOptions()) {
+        if (opts.cell_sizes.empty()) throw std::invalid_argument("CRP needs at least one level");
+        for (std::size_t l = 0; l < opts.cell_sizes.size(); ++l) {
+            if (opts.cell_sizes[l] == 0 || (l > 0 && opts.cell_sizes[l] <= opts.cell_sizes[l - 1])) {
+                throw std::invalid_argument("CRP cell sizes must be positive and increasing");
+            }
+        }
+
+        CRPOverlay o;
+        o.n_ = G.num_vertices();
+        o.m_ = G.num_edges();
+        const std::size_t L = opts.cell_sizes.size();
+        o.cell_.resize(L);
+        o.levels_.resize(L);
+
+        // Undirected adjacency for region growing
+        std::vector<std::vector<std::uint32_t>> adj(o.n_);
+        for (const auto& e : G.edges()) {
+            const VertexId u = e.source().id(), v = e.destination().id();
+            if (u == v) continue;
+            adj[u].push_back(static_cast<std::uint32_t>(v));
+            adj[v].push_back(static_cast<std::uint32_t>(u));
+        }
+        std::vector<std::size_t> unit(o.n_, 1);
+        std::vector<std::uint32_t> grouping = grow_regions(adj, unit, opts.cell_sizes[0]);
+        o.cell_[0] = grouping;
+
+        for (std::size_t l = 1; l < L; ++l) {
+            // Contract the level below into a cell graph and grow regions on it
+            const std::size_t cells = count_cells(o.cell_[l - 1]);
+            std::vector<std::vector<std::uint32_t>> cadj(cells);
+            std::vector<std::size_t> csize(cells, 0);
+            for (VertexId v = 0; v < o.n_; ++v) csize[o.cell_[l - 1][v]]++;
+            for (const auto& e : G.edges()) {
+                const auto a = o.cell_[l - 1][e.source().id()], b = o.cell_[l - 1][e.destination().id()];
+                if (a == b) continue;
+                cadj[a].push_back(b);
+                cadj[b].push_back(a);
+            }
+            for (auto& nbrs : cadj) {
+                std::sort(nbrs.begin(), nbrs.end());
+                nbrs.erase(std::unique(nbrs.begin(), nbrs.end()), nbrs.end());
+            }
+            grouping = grow_regions(cadj, csize, opts.cell_sizes[l]);
+            o.cell_[l].resize(o.n_);
+            for (VertexId v = 0; v < o.n_; ++v) o.cell_[l][v] = grouping[o.cell_[l - 1][v]];
+        }
+
+        for (std::size_t l = 0; l < L; ++l) o.build_boundary(G, l);
+        return o;
+    }
+
+    /**
+     * @brief Recompute all cliques from a weight column indexed by EdgeId
+     */
+    void customize(const Graph& G, const std::vector<Weight>& weights, std::size_t num_threads = 0) {
+        if (G.num_vertices() != n_ || G.num_edges() != m_) {
+            throw std::invalid_argument("Graph does not match the CRP topology");
+        }
+        if (weights.size() < G.edge_id_bound()) {
+            throw std::invalid_argument("Weight column must have one entry per edge id");
+        }
+        for (const auto& e : G.edges()) {
+            if (!(weights[e.id()] >= 0)) throw std::invalid_argument("Edge weight must be non-negative");
+        }
+        weights_ = weights;
+
+        const std::size_t threads = resolve_threads(num_threads);
+        std::vector<Workspace> workspaces(threads);
+        for (std::size_t l = 0; l < levels_.size(); ++l) {
+            Level& lv = levels_[l];
+            const int scan_level = static_cast<int>(l) - 1;
+            parallel_for(lv.cells.size(), threads, [&](std::size_t c, std::size_t tid) {
+                Workspace& ws = workspaces[tid];
+                ws.prepare(n_);
+                const Cell& cell = lv.cells[c];
+                auto inside = [&](VertexId v) { return cell_[l][v] == c; };
+                for (std::size_t i = 0; i < cell.entries.size(); ++i) {
+                    ws.touch(cell.entries[i]);
+                    ws.dist[cell.entries[i]] = 0.0;
+                    ws.heap.insert(Vertex(cell.entries[i]), 0.0);
+                    while (!ws.heap.empty()) {
+                        auto [u, du] = ws.heap.extract_min();
+                        scan(G, scan_level, u.id(), du, ws, inside);
+                    }
+                    Weight* row = &lv.clique[cell.offset + i * cell.exits.size()];
+                    for (std::size_t j = 0; j < cell.exits.size(); ++j) row[j] = ws.dist[cell.exits[j]];
+                    ws.reset();
+                }
+            });
+        }
+        customized_ = true;
+    }
+
+    /**
+     * @brief Customize with the weights currently stored in G
+     */
+    void customize(const Graph& G, std::size_t num_threads = 0) {
+        std::vector<Weight> weights(G.edge_id_bound());
+        for (const auto& e : G.edges()) weights[e.id()] = e.weight();
+        customize(G, weights, num_threads);
+    }
+
+    CRPQueryResult query(const Graph& G, const Vertex& source, const Vertex& target) const {
+        if (!customized_) throw std::runtime_error("CRP overlay has not been customized");
+        CRPQueryResult result{INFINITE_WEIGHT, 0};
+        const VertexId s = source.id(), t = target.id();
+        if (s >= n_ || t >= n_) return result;
+
+        thread_local Workspace ws;
+        ws.prepare(n_);
+        ws.touch(s);
+        ws.dist[s] = 0.0;
+        ws.heap.insert(source, 0.0);
+        auto anywhere = [](VertexId) { return true; };
+        while (!ws.heap.empty()) {
+            auto [u, du] = ws.heap.extract_min();
+            result.settled++;
+            if (u.id() == t) {
+                result.distance = du;
+                break;
+            }
+            scan(G, query_level(u.id(), s, t), u.id(), du, ws, anywhere);
+        }
+        ws.reset();
+        return result;
+    }
+
+    [[nodiscard]] std::size_t num_levels() const noexcept { return levels_.size(); }
+    [[nodiscard]] std::size_t num_cells(std::size_t level) const { return levels_[level].cells.size(); }
+    [[nodiscard]] std::size_t cell(std::size_t level, VertexId v) const { return cell_[level][v]; }
+    [[nodiscard]] const std::vector<VertexId>& entries(std::size_t level, std::size_t c) const {
+        return levels_[level].cells[c].entries;
+    }
+    [[nodiscard]] const std::vector<VertexId>& exits(std::size_t level, std::size_t c) const {
+        return levels_[level].cells[c].exits;
+    }
+    [[nodiscard]] bool is_customized() const noexcept { return customized_; }
+
+private:
+    static constexpr std::uint32_t UNASSIGNED = std::numeric_limits<std::uint32_t>::max();
+    static constexpr std::int32_t NOT_BOUNDARY = -1;
+
+    struct Cell {
+        std::vector<VertexId> entries;   // vertices with an edge from outside the cell
+        std::vector<VertexId> exits;     // vertices with an edge to outside the cell
+        std::size_t offset = 0;          // start of the entries x exits block in Level::clique
+    };
+
+    struct Level {
+        std::vector<Cell> cells;
+        std::vector<std::int32_t> entry_pos;   // index in its cell's entries, or NOT_BOUNDARY
+        std::vector<Weight> clique;
+    };
+
+    struct Workspace {
+        std::vector<Weight> dist;
+        std::vector<VertexId> touched;
+        BinaryHeap heap;
+
+        void prepare(std::size_t n) {
+            if (dist.size() != n) {
+                dist.assign(n, INFINITE_WEIGHT);
+                touched.clear();
+            }
+            heap.clear();
+        }
+
+        void touch(VertexId v) {
+            if (dist[v] == INFINITE_WEIGHT) touched.push_back(v);
+        }
+
+        void reset() {
+            for (VertexId v : touched) dist[v] = INFINITE_WEIGHT;
+            touched.clear();
+            heap.clear();
+        }
+    };
+
+    std::size_t n_ = 0;
+    std::size_t m_ = 0;
+    std::vector<std::vector<std::uint32_t>> cell_;   // cell_[level][vertex]
+    std::vector<Level> levels_;
+    std::vector<Weight> weights_;
+    bool customized_ = false;
+
+    /**
+     * @brief Greedy BFS region growing with a size cap per region
+     */
+    static std::vector<std::uint32_t> grow_regions(const std::vector<std::vector<std::uint32_t>>& adj,
+                                                   const std::vector<std::size_t>& size, std::size_t cap) {
+        std::vector<std::uint32_t> region(adj.size(), UNASSIGNED);
+        std::vector<std::uint32_t> queue;
+        std::uint32_t next = 0;
+        for (std::size_t root = 0; root < adj.size(); ++root) {
+            if (region[root] != UNASSIGNED) continue;
+            const std::uint32_t id = next++;
+            std::size_t total = size[root];
+            region[root] = id;
+            queue.assign(1, static_cast<std::uint32_t>(root));
+            for (std::size_t head = 0; head < queue.size() && total < cap; ++head) {
+                for (std::uint32_t w : adj[queue[head]]) {
+                    if (region[w] != UNASSIGNED || total + size[w] > cap) continue;
+                    region[w] = id;
+                    total += size[w];
+                    queue.push_back(w);
+                }
+            }
+        }
+        return region;
+    }
+
+    static std::size_t count_cells(const std::vector<std::uint32_t>& cells) {
+        std::size_t count = 0;
+        for (auto c : cells) count = std::max<std::size_t>(count, std::size_t(c) + 1);
+        return count;
+    }
+
+    void build_boundary(const Graph& G, std::size_t l) {
+        const auto& cl = cell_[l];
+        std::vector<char> is_entry(n_, 0), is_exit(n_, 0);
+        for (const auto& e : G.edges()) {
+            const VertexId u = e.source().id(), v = e.destination().id();
+            if (cl[u] == cl[v]) continue;
+            is_exit[u] = 1;
+            is_entry[v] = 1;
+        }
+        Level& lv = levels_[l];
+        lv.cells.assign(count_cells(cl), Cell());
+        lv.entry_pos.assign(n_, NOT_BOUNDARY);
+        for (VertexId v = 0; v < n_; ++v) {
+            Cell& c = lv.cells[cl[v]];
+            if (is_entry[v]) {
+                lv.entry_pos[v] = static_cast<std::int32_t>(c.entries.size());
+                c.entries.push_back(v);
+            }
+            if (is_exit[v]) c.exits.push_back(v);
+        }
+        std::size_t offset = 0;
+        for (auto& c : lv.cells) {
+            c.offset = offset;
+            offset += c.entries.size() * c.exits.size();
+        }
+        lv.clique.assign(offset, INFINITE_WEIGHT);
+    }
+
+    // Highest level whose cell of u contains neither s nor t; -1 if none
+    int query_level(VertexId u, VertexId s, VertexId t) const {
+        for (std::size_t l = levels_.size(); l-- > 0;) {
+            const auto c = cell_[l][u];
+            if (c != cell_[l][s] && c != cell_[l][t]) return static_cast<int>(l);
+        }
+        return -1;
+    }
+
+    /**
+     * @brief Relax the arcs of u as seen at `level` (-1 = original edges)
+     *
+     * At level >= 0, u uses the clique of its cell if it is an entry, plus
+     * the original edges leaving that cell. Only heads accepted by `inside`
+     * are relaxed.
+     */
+    template <class Inside>
+    void scan(const Graph& G, int level, VertexId u, Weight du, Workspace& ws, Inside&& inside) const {
+        auto relax = [&](VertexId v, Weight alt) {
+            if (alt < ws.dist[v]) {
+                ws.touch(v);
+                ws.dist[v] = alt;
+                ws.heap.insert(Vertex(v), alt);
+            }
+        };
+        if (level < 0) {
+            for (const auto& e : G.get_outgoing_edges(u)) {
+                const VertexId v = e.destination().id();
+                if (inside(v)) relax(v, du + weights_[e.id()]);
+            }
+            return;
+        }
+        const Level& lv = levels_[level];
+        const auto c = cell_[level][u];
+        const std::int32_t pos = lv.entry_pos[u];
+        if (pos != NOT_BOUNDARY) {
+            const Cell& cell = lv.cells[c];
+            const Weight* row = &lv.clique[cell.offset + static_cast<std::size_t>(pos) * cell.exits.size()];
+            for (std::size_t j = 0; j < cell.exits.size(); ++j) {
+                if (row[j] < INFINITE_WEIGHT) relax(cell.exits[j], du + row[j]);
+            }
+        }
+        for (const auto& e : G.get_outgoing_edges(u)) {
+            const VertexId v = e.destination().id();
+            if (cell_[level][v] != c && inside(v)) relax(v, du + weights_[e.id()]);
+        }
+    }
+};
+
+} // namespace sssp
+
+#endif // SSSP_CRP_HPP
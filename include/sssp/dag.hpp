@@ -0,0 +1,59 @@
+#ifndef SSSP_DAG_HPP
+#define SSSP_DAG_HPP
+
+#include "sssp/types.hpp"
+#include "sssp/graph.hpp"
+#include <vector>
+#include <stdexcept>
+
+namespace sssp {
+
+/**
+ * @brief Single-source shortest paths on a DAG in one sweep
+ *
+ * Vertices are visited in G.topological_order() (reversed for dir =
+ * Incoming) and each reached vertex relaxes its edges once. Every vertex is
+ * final when visited, so no priority queue is needed and the run is
+ * O(n + m). Vertices before the source in the order are unreachable and
+ * are skipped.
+ *
+ * Output matches solveSSSP: dist and pred in the caller's DistState; with
+ * dir = Incoming, pred holds successors.
+ *
+ * @throws std::invalid_argument if G has a cycle
+ */
+class DAGShortestPaths {
+public:
+    static void run(const Graph& G, const Vertex& source, DistState& state,
+                    EdgeDirection dir = EdgeDirection::Outgoing) {
+        if (!G.is_acyclic()) {
+            throw std::invalid_argument("DAGShortestPaths requires an acyclic graph");
+        }
+        state.init(G.num_vertices());
+        if (!G.has_vertex(source)) return;
+        state.set(source.id(), 0.0);
+
+        const auto& order = G.topological_order();
+        const std::size_t n = order.size();
+        bool started = false;
+        for (std::size_t i = 0; i < n; ++i) {
+            const VertexId u = order[dir == EdgeDirection::Outgoing ? i : n - 1 - i];
+            started = started || u == source.id();
+            if (!started) continue;
+            const Weight du = state.get(u);
+            if (du == INFINITE_WEIGHT) continue;
+            for (const auto& e : G.get_edges(Vertex(u), dir)) {
+                const VertexId v = Graph::far_end(e, dir).id();
+                const Weight alt = du + e.weight();
+                if (alt < state.get(v)) {
+                    state.set(v, alt);
+                    state.set_pred(v, u);
+                }
+            }
+        }
+    }
+};
+
+} // namespace sssp
+
+#endif // SSSP_DAG_HPP
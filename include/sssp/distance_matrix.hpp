@@ -0,0 +1,124 @@
+#ifndef SSSP_DISTANCE_MATRIX_HPP
+#define SSSP_DISTANCE_MATRIX_HPP
+
+#include "sssp/types.hpp"
+#include "sssp/graph.hpp"
+#include "sssp/binary_heap.hpp"
+#include "sssp/parallel.hpp"
+#include <vector>
+#include <cstdint>
+#include <stdexcept>
+
+namespace sssp {
+
+/**
+ * @brief Dense row-major |sources| x |targets| distance table
+ */
+struct DistanceMatrix {
+    std::size_t rows = 0;
+    std::size_t cols = 0;
+    std::vector<Weight> data;   // data[i * cols + j] = d(sources[i], targets[j])
+
+    [[nodiscard]] Weight at(std::size_t i, std::size_t j) const { return data[i * cols + j]; }
+    [[nodiscard]] const Weight* row(std::size_t i) const { return data.data() + i * cols; }
+};
+
+namespace detail {
+
+struct MatrixWorkspace {
+    std::vector<Weight> dist;
+    std::vector<VertexId> touched;
+    BinaryHeap heap;
+};
+
+} // namespace detail
+
+/**
+ * @brief Many-to-many distances with target-set pruning
+ *
+ * Runs one Dijkstra per source, stopping as soon as every distinct target
+ * has been settled, so sources close to their targets never explore the
+ * rest of the graph. The adjacency is flattened into CSR arrays once per
+ * call and shared by all searches. Sources are distributed over threads
+ * with one reusable workspace (distance array, touched list, heap) per
+ * thread; nothing is allocated per source. Unreachable pairs are
+ * INFINITE_WEIGHT.
+ *
+ * @throws std::invalid_argument if a source or target is not a vertex of G
+ */
+inline DistanceMatrix distanceMatrix(const Graph& G, const std::vector<Vertex>& sources,
+                                     const std::vector<Vertex>& targets, std::size_t num_threads = 0) {
+    const std::size_t n = G.num_vertices();
+    DistanceMatrix M;
+    M.rows = sources.size();
+    M.cols = targets.size();
+    M.data.assign(M.rows * M.cols, INFINITE_WEIGHT);
+
+    // is_target[v] = 1 for every distinct target; the search stops after
+    // settling distinct_targets of them
+    std::vector<std::uint8_t> is_target(n, 0);
+    std::size_t distinct_targets = 0;
+    for (const auto& t : targets) {
+        if (t.id() >= n) throw std::invalid_argument("Target is not a vertex of the graph");
+        if (!is_target[t.id()]) {
+            is_target[t.id()] = 1;
+            distinct_targets++;
+        }
+    }
+    for (const auto& s : sources) {
+        if (s.id() >= n) throw std::invalid_argument("Source is not a vertex of the graph");
+    }
+    if (M.rows == 0 || M.cols == 0) return M;
+
+    // Flatten the adjacency once so searches avoid per-vertex hash lookups
+    std::vector<std::size_t> offsets(n + 1, 0);
+    std::vector<VertexId> heads;
+    std::vector<Weight> weights;
+    heads.reserve(G.num_edges());
+    weights.reserve(G.num_edges());
+    for (VertexId u = 0; u < n; ++u) {
+        for (const auto& e : G.get_outgoing_edges(u)) {
+            heads.push_back(e.destination().id());
+            weights.push_back(e.weight());
+        }
+        offsets[u + 1] = heads.size();
+    }
+
+    const std::size_t threads = resolve_threads(num_threads);
+    std::vector<detail::MatrixWorkspace> workspaces(threads);
+    parallel_for(M.rows, threads, [&](std::size_t i, std::size_t tid) {
+        auto& ws = workspaces[tid];
+        if (ws.dist.size() != n) ws.dist.assign(n, INFINITE_WEIGHT);
+
+        const VertexId s = sources[i].id();
+        ws.dist[s] = 0.0;
+        ws.touched.push_back(s);
+        ws.heap.insert(sources[i], 0.0);
+        std::size_t remaining = distinct_targets;
+        while (!ws.heap.empty()) {
+            auto [u, du] = ws.heap.extract_min();
+            if (is_target[u.id()] && --remaining == 0) break;
+            for (std::size_t a = offsets[u.id()]; a < offsets[u.id() + 1]; ++a) {
+                const VertexId v = heads[a];
+                const Weight alt = du + weights[a];
+                if (alt < ws.dist[v]) {
+                    if (ws.dist[v] == INFINITE_WEIGHT) ws.touched.push_back(v);
+                    ws.dist[v] = alt;
+                    ws.heap.insert(Vertex(v), alt);
+                }
+            }
+        }
+
+        Weight* out = M.data.data() + i * M.cols;
+        for (std::size_t j = 0; j < M.cols; ++j) out[j] = ws.dist[targets[j].id()];
+
+        for (VertexId v : ws.touched) ws.dist[v] = INFINITE_WEIGHT;
+        ws.touched.clear();
+        ws.heap.clear();
+    });
+    return M;
+}
+
+} // namespace sssp
+
+#endif // SSSP_DISTANCE_MATRIX_HPP
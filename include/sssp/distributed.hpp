@@ -0,0 +1,323 @@
+#ifndef SSSP_DISTRIBUTED_HPP
+#define SSSP_DISTRIBUTED_HPP
+
+#include "sssp/types.hpp"
+#include "sssp/graph.hpp"
+#include "sssp/transport.hpp"
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <map>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace sssp {
+
+/**
+ * @brief The edges leaving one block of vertices, as owned by one rank
+ *
+ * Vertices are split into `parts` contiguous blocks of ceil(n / parts) ids;
+ * rank r owns block r and stores only the out-edges of its own vertices as
+ * CSR arrays. Contiguous blocks keep neighbours together on graphs whose ids
+ * follow the geometry (grids, most road network dumps), so few edges cross
+ * ranks.
+ */
+struct GraphPartition {
+    std::size_t num_vertices = 0;   // global n
+    std::size_t rank = 0;
+    std::size_t parts = 1;
+    VertexId first = 0;             // owned ids are [first, last)
+    VertexId last = 0;
+    std::vector<std::size_t> offsets;   // local vertex v - first -> edge range
+    std::vector<VertexId> heads;        // global ids
+    std::vector<Weight> weights;
+
+    [[nodiscard]] std::size_t block() const noexcept { return std::max<std::size_t>(1, (num_vertices + parts - 1) / parts); }
+    [[nodiscard]] std::size_t owner(VertexId v) const noexcept { return v / block(); }
+    [[nodiscard]] bool owns(VertexId v) const noexcept { return v >= first && v < last; }
+    [[nodiscard]] std::size_t num_local() const noexcept { return last - first; }
+
+    /**
+     * @brief Partition `rank` of an in-memory graph
+     *
+     * dir = Incoming stores reverse edges, for single-target searches.
+     */
+    static GraphPartition from_graph(const Graph& G, std::size_t rank, std::size_t parts,
+                                     EdgeDirection dir = EdgeDirection::Outgoing) {
+        GraphPartition p = empty(G.num_vertices(), rank, parts);
+        for (VertexId u = p.first; u < p.last; ++u) {
+            for (const auto& e : G.get_edges(Vertex(u), dir)) {
+                p.heads.push_back(Graph::far_end(e, dir).id());
+                p.weights.push_back(e.weight());
+            }
+            p.offsets[u - p.first + 1] = p.heads.size();
+        }
+        return p;
+    }
+
+    /**
+     * @brief Partition `rank` read straight from an edge-list file
+     *
+     * Lines are "u v w" with 0-based ids, or DIMACS ("p sp n m" then
+     * "a u v w" with 1-based ids); "c" and "#" lines are skipped. The file
+     * is streamed twice (once for n unless a "p" line gives it) and only
+     * the owned edges are kept, so no rank ever holds the whole graph.
+     *
+     * @throws std::runtime_error if the file cannot be read or a line is malformed
+     */
+    static GraphPartition load_edge_list(const std::string& path, std::size_t rank, std::size_t parts) {
+        std::size_t n = 0;
+        bool dimacs = false;
+        for_each_edge(path, dimacs, n, [&](VertexId u, VertexId v, Weight) { n = std::max(n, std::max(u, v) + 1); });
+        GraphPartition p = empty(n, rank, parts);
+        std::vector<std::pair<VertexId, std::pair<VertexId, Weight>>> owned;
+        std::size_t unused = n;
+        for_each_edge(path, dimacs, unused, [&](VertexId u, VertexId v, Weight w) {
+            if (p.owns(u)) owned.push_back({u, {v, w}});
+        });
+        std::stable_sort(owned.begin(), owned.end(), [](const auto& a, const auto& b) { return a.first < b.first; });
+        for (const auto& [u, edge] : owned) {
+            p.heads.push_back(edge.first);
+            p.weights.push_back(edge.second);
+            p.offsets[u - p.first + 1]++;
+        }
+        for (std::size_t i = 0; i < p.num_local(); ++i) p.offsets[i + 1] += p.offsets[i];
+        return p;
+    }
+
+private:
+    static GraphPartition empty(std::size_t n, std::size_t rank, std::size_t parts) {
+        if (parts == 0 || rank >= parts) throw std::invalid_argument("GraphPartition rank out of range");
+        GraphPartition p;
+        p.num_vertices = n;
+        p.rank = rank;
+        p.parts = parts;
+        p.first = std::min(n, rank * p.block());
+        p.last = std::min(n, p.first + p.block());
+        p.offsets.assign(p.num_local() + 1, 0);
+        return p;
+    }
+
+    // Calls fn(u, v, w) per edge with 0-based ids; sets dimacs and n from a "p" line
+    template <class Fn>
+    static void for_each_edge(const std::string& path, bool& dimacs, std::size_t& n, Fn&& fn) {
+        std::ifstream in(path);
+        if (!in) throw std::runtime_error("Cannot open edge list: " + path);
+        std::string line;
+        while (std::getline(in, line)) {
+            if (line.empty() || line[0] == 'c' || line[0] == '#') continue;
+            if (line[0] == 'p') {
+                std::istringstream fields(line.substr(1));
+                std::string kind;
+                std::size_t nodes = 0;
+                if (!(fields >> kind >> nodes)) throw std::runtime_error("Bad problem line in " + path + ": " + line);
+                dimacs = true;
+                n = std::max(n, nodes);
+                continue;
+            }
+            std::istringstream fields(line[0] == 'a' ? line.substr(1) : line);
+            long long u = 0, v = 0;
+            double w = 0.0;
+            const long long base = dimacs ? 1 : 0;
+            if (!(fields >> u >> v >> w) || u < base || v < base || w < 0.0) {
+                throw std::runtime_error("Bad edge line in " + path + ": " + line);
+            }
+            fn(static_cast<VertexId>(u - base), static_cast<VertexId>(v - base), w);
+        }
+    }
+};
+
+struct DistributedOptions {
+    Weight delta = 0.0;   // bucket width; 0 = mean edge weight over all ranks
+};
+
+/**
+ * @brief Distances and preds of the vertices one rank owns
+ */
+struct DistributedResult {
+    std::vector<Weight> dist;     // indexed by v - partition.first
+    std::vector<VertexId> pred;   // global ids, INVALID_VERTEX for the source and unreached
+    std::size_t supersteps = 0;   // exchanges of relaxation requests
+    std::size_t remote_relaxations = 0;   // requests this rank sent to other ranks
+};
+
+/**
+ * @brief Bulk-synchronous delta-stepping over a partitioned graph
+ *
+ * Every rank runs the same loop on its own partition. Tentative distances
+ * are bucketed by floor(d / delta); the globally smallest non-empty bucket
+ * is agreed on with an all-reduce, then its vertices relax their light
+ * edges (w <= delta) in rounds until no rank re-fills the bucket, and
+ * finally their heavy edges once. Each round is one superstep: relaxations
+ * of remote vertices are batched per owner and sent in a single
+ * Transport::exchange, then applied by the owner.
+ *
+ * All ranks must call run() with the same source and options.
+ */
+class DistributedSSSP {
+public:
+    static DistributedResult run(const GraphPartition& part, Transport& transport, VertexId source,
+                                 const DistributedOptions& opts = DistributedOptions()) {
+        if (transport.size() != part.parts || transport.rank() != part.rank) {
+            throw std::invalid_argument("Partition does not match the transport's rank layout");
+        }
+        Engine engine(part, transport);
+        double delta = opts.delta;
+        if (delta <= 0.0) {
+            double local = 0.0;
+            for (Weight w : part.weights) local += w;
+            const double sum = transport.all_reduce_sum(local);
+            const double count = transport.all_reduce_sum(static_cast<double>(part.weights.size()));
+            delta = count > 0.0 && sum > 0.0 ? sum / count : 1.0;
+        }
+        engine.solve(source, delta);
+        return std::move(engine.result);
+    }
+
+    /**
+     * @brief Collect every rank's result on rank 0 (collective)
+     *
+     * @return the full DistState on rank 0, an empty one elsewhere
+     */
+    static DistState gather(const GraphPartition& part, Transport& transport, const DistributedResult& local) {
+        std::vector<Message> out(transport.size());
+        Message& mine = out[0];
+        append(mine, local.dist.data(), local.dist.size() * sizeof(Weight));
+        append(mine, local.pred.data(), local.pred.size() * sizeof(VertexId));
+        std::vector<Message> in = transport.exchange(std::move(out));
+        DistState state;
+        if (transport.rank() != 0) return state;
+        state.init(part.num_vertices);
+        for (std::size_t r = 0; r < in.size(); ++r) {
+            const VertexId first = std::min(part.num_vertices, r * part.block());
+            const std::size_t count = std::min(part.num_vertices, first + part.block()) - first;
+            if (in[r].size() != count * (sizeof(Weight) + sizeof(VertexId))) {
+                throw std::runtime_error("Malformed result from rank " + std::to_string(r));
+            }
+            std::memcpy(state.dist.data() + first, in[r].data(), count * sizeof(Weight));
+            std::memcpy(state.pred.data() + first, in[r].data() + count * sizeof(Weight), count * sizeof(VertexId));
+        }
+        return state;
+    }
+
+private:
+    // One relaxation request as sent between ranks
+    struct Relax {
+        VertexId target;
+        Weight dist;
+        VertexId pred;
+    };
+
+    static void append(Message& m, const void* data, std::size_t bytes) {
+        const std::size_t at = m.size();
+        m.resize(at + bytes);
+        if (bytes > 0) std::memcpy(m.data() + at, data, bytes);
+    }
+
+    struct Engine {
+        const GraphPartition& part;
+        Transport& transport;
+        DistributedResult result;
+        std::map<std::uint64_t, std::vector<VertexId>> buckets;   // local ids; may hold stale copies
+        std::vector<std::vector<Relax>> outbox;
+        std::vector<char> settled_mark;
+        Weight delta = 1.0;
+
+        Engine(const GraphPartition& p, Transport& t) : part(p), transport(t), outbox(t.size()) {
+            result.dist.assign(p.num_local(), INFINITE_WEIGHT);
+            result.pred.assign(p.num_local(), INVALID_VERTEX);
+            settled_mark.assign(p.num_local(), 0);
+        }
+
+        std::uint64_t bucket_of(Weight d) const {
+            const double b = d / delta;
+            return b >= 1.8e19 ? UINT64_MAX - 1 : static_cast<std::uint64_t>(b);
+        }
+
+        void improve(VertexId v, Weight d, VertexId pred) {
+            const std::size_t i = v - part.first;
+            if (!(d < result.dist[i])) return;
+            result.dist[i] = d;
+            result.pred[i] = pred;
+            buckets[bucket_of(d)].push_back(i);
+        }
+
+        void relax(std::size_t i, bool light) {
+            const VertexId u = part.first + i;
+            const Weight du = result.dist[i];
+            for (std::size_t e = part.offsets[i]; e < part.offsets[i + 1]; ++e) {
+                if ((part.weights[e] <= delta) != light) continue;
+                const VertexId v = part.heads[e];
+                const Weight d = du + part.weights[e];
+                if (part.owns(v)) {
+                    improve(v, d, u);
+                } else {
+                    outbox[part.owner(v)].push_back(Relax{v, d, u});
+                }
+            }
+        }
+
+        // Ships the batched remote relaxations and applies the ones received
+        void superstep() {
+            std::vector<Message> out(transport.size());
+            for (std::size_t r = 0; r < outbox.size(); ++r) {
+                result.remote_relaxations += outbox[r].size();
+                append(out[r], outbox[r].data(), outbox[r].size() * sizeof(Relax));
+                outbox[r].clear();
+            }
+            for (const Message& m : transport.exchange(std::move(out))) {
+                if (m.size() % sizeof(Relax) != 0) throw std::runtime_error("Malformed relaxation batch");
+                for (std::size_t at = 0; at < m.size(); at += sizeof(Relax)) {
+                    Relax req;
+                    std::memcpy(&req, m.data() + at, sizeof(Relax));
+                    if (!part.owns(req.target)) throw std::runtime_error("Relaxation sent to the wrong rank");
+                    improve(req.target, req.dist, req.pred);
+                }
+            }
+            result.supersteps++;
+        }
+
+        void solve(VertexId source, Weight bucket_width) {
+            delta = bucket_width;
+            if (part.owns(source)) improve(source, 0.0, INVALID_VERTEX);
+            std::vector<std::size_t> settled, frontier;
+            while (true) {
+                const std::uint64_t b = transport.all_reduce_min(buckets.empty() ? UINT64_MAX : buckets.begin()->first);
+                if (b == UINT64_MAX) break;
+                settled.clear();
+                // Light phase: rounds until no rank re-fills bucket b
+                while (true) {
+                    frontier.clear();
+                    auto it = buckets.find(b);
+                    if (it != buckets.end()) {
+                        frontier.swap(it->second);
+                        buckets.erase(it);
+                    }
+                    for (std::size_t i : frontier) {
+                        if (bucket_of(result.dist[i]) != b) continue;   // stale copy
+                        if (!settled_mark[i]) {
+                            settled_mark[i] = 1;
+                            settled.push_back(i);
+                        }
+                        relax(i, true);
+                    }
+                    superstep();
+                    if (transport.all_reduce_min(buckets.count(b) ? 0 : 1) == 1) break;
+                }
+                // Heavy phase: distances in bucket b are final now
+                for (std::size_t i : settled) {
+                    settled_mark[i] = 0;
+                    relax(i, false);
+                }
+                superstep();
+            }
+        }
+    };
+};
+
+} // namespace sssp
+
+#endif // SSSP_DISTRIBUTED_HPP
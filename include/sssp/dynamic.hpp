@@ -0,0 +1,253 @@
+#ifndef SSSP_DYNAMIC_HPP
+#define SSSP_DYNAMIC_HPP
+
+#include "sssp/types.hpp"
+#include "sssp/graph.hpp"
+#include "sssp/binary_heap.hpp"
+#include "sssp/parallel.hpp"
+#include <vector>
+#include <algorithm>
+
+namespace sssp {
+
+/**
+ * @brief Work done by one repair call
+ */
+struct RepairStats {
+    std::size_t seeds = 0;      // heads improved by a changed edge / re-seeded vertices
+    std::size_t improved = 0;   // vertices (re)settled by the repair search
+    std::size_t affected = 0;   // vertices reset because their tree path broke
+};
+
+namespace detail {
+
+// Grow a state to cover vertices added to G since it was computed
+inline void fit_state(const Graph& G, DistState& state) {
+    const std::size_t n = G.num_vertices();
+    if (state.dist.size() < n) {
+        state.dist.resize(n, INFINITE_WEIGHT);
+        state.pred.resize(n, INVALID_VERTEX);
+    }
+}
+
+inline EdgeDirection opposite(EdgeDirection dir) {
+    return dir == EdgeDirection::Outgoing ? EdgeDirection::Incoming : EdgeDirection::Outgoing;
+}
+
+/**
+ * @brief Children of every vertex in the pred forest, as flat CSR arrays
+ */
+struct ChildrenIndex {
+    std::vector<std::size_t> offsets;
+    std::vector<VertexId> children;
+
+    explicit ChildrenIndex(const DistState& state) {
+        const std::size_t n = state.pred.size();
+        offsets.assign(n + 1, 0);
+        for (VertexId v = 0; v < n; ++v) {
+            if (state.has_pred(v)) offsets[state.get_pred(v) + 1]++;
+        }
+        for (std::size_t i = 0; i < n; ++i) offsets[i + 1] += offsets[i];
+        children.resize(offsets[n]);
+        std::vector<std::size_t> fill(offsets.begin(), offsets.end() - 1);
+        for (VertexId v = 0; v < n; ++v) {
+            if (state.has_pred(v)) children[fill[state.get_pred(v)]++] = v;
+        }
+    }
+};
+
+} // namespace detail
+
+/**
+ * @brief Repair a shortest-path tree after edge insertions or weight decreases
+ *
+ * G must already contain the change (add_edge / set_edge_weight); `changed`
+ * lists the ids of the inserted or cheaper edges. Every changed edge whose
+ * head improves seeds a Dijkstra that only follows strict improvements, so
+ * the work is proportional to the set of vertices whose distance drops and
+ * their out-edges. dist and pred are updated in place.
+ *
+ * dir must match the direction the state was computed with: Outgoing for
+ * solveSSSP trees, Incoming for solveReverseSSSP trees (pred = successor).
+ *
+ * @param heap Reusable heap; pass one in when repairing many trees
+ */
+inline RepairStats repairAfterDecrease(const Graph& G, DistState& state, const std::vector<EdgeId>& changed,
+                                       EdgeDirection dir, BinaryHeap& heap) {
+    RepairStats stats;
+    detail::fit_state(G, state);
+    heap.clear();
+    for (EdgeId id : changed) {
+        const Edge& e = G.edge(id);
+        const Vertex& near = dir == EdgeDirection::Outgoing ? e.source() : e.destination();
+        const Vertex& far = Graph::far_end(e, dir);
+        const Weight alt = state.get(near.id()) + e.weight();
+        if (alt < state.get(far.id())) {
+            state.set(far.id(), alt);
+            state.set_pred(far.id(), near.id());
+            heap.insert(far, alt);
+            stats.seeds++;
+        }
+    }
+    while (!heap.empty()) {
+        auto [u, du] = heap.extract_min();
+        stats.improved++;
+        for (const auto& e : G.get_edges(u, dir)) {
+            const Vertex& v = Graph::far_end(e, dir);
+            const Weight alt = du + e.weight();
+            if (alt < state.get(v.id())) {
+                state.set(v.id(), alt);
+                state.set_pred(v.id(), u.id());
+                heap.insert(v, alt);
+            }
+        }
+    }
+    return stats;
+}
+
+inline RepairStats repairAfterDecrease(const Graph& G, DistState& state, const std::vector<EdgeId>& changed,
+                                       EdgeDirection dir = EdgeDirection::Outgoing) {
+    BinaryHeap heap;
+    return repairAfterDecrease(G, state, changed, dir, heap);
+}
+
+/**
+ * @brief Repair many maintained trees for the same batch of changes
+ *
+ * Trees are distributed over threads, each thread reusing one heap.
+ * Returns the per-tree statistics.
+ */
+inline std::vector<RepairStats> repairAfterDecrease(const Graph& G, std::vector<DistState>& states,
+                                                    const std::vector<EdgeId>& changed,
+                                                    EdgeDirection dir = EdgeDirection::Outgoing,
+                                                    std::size_t num_threads = 0) {
+    std::vector<RepairStats> stats(states.size());
+    const std::size_t threads = resolve_threads(num_threads);
+    std::vector<BinaryHeap> heaps(threads);
+    parallel_for(states.size(), threads, [&](std::size_t i, std::size_t tid) {
+        stats[i] = repairAfterDecrease(G, states[i], changed, dir, heaps[tid]);
+    });
+    return stats;
+}
+
+/**
+ * @brief Repair a shortest-path tree after weight increases or edge deletions
+ *
+ * G must already contain the change (set_edge_weight / remove_edge);
+ * `changed` holds the edges as they were before the change (copies taken
+ * from G.edge(id)). Follows Ramalingam-Reps:
+ *
+ * 1. A changed edge matters only if it was the tree edge of its head and no
+ *    remaining parallel edge is still tight. Such heads are the roots of the
+ *    invalidated region.
+ * 2. The subtrees below those roots are collected through a children index
+ *    of pred and reset to infinity.
+ * 3. Every reset vertex is seeded with its best in-edge from an unaffected
+ *    neighbour, and a Dijkstra re-settles the region. Unaffected vertices
+ *    keep their distances, since increases cannot shorten any path.
+ *
+ * Building the children index is one O(n) pass over pred; the searches only
+ * touch the affected subtree and its incident edges.
+ *
+ * dir must match the direction the state was computed with (see
+ * repairAfterDecrease).
+ */
+inline RepairStats repairAfterIncrease(const Graph& G, DistState& state, const std::vector<Edge>& changed,
+                                       EdgeDirection dir, BinaryHeap& heap) {
+    RepairStats stats;
+    detail::fit_state(G, state);
+    heap.clear();
+
+    // Step 1: roots whose tree edge was among the changed edges
+    std::vector<VertexId> stack;
+    for (const auto& old : changed) {
+        const VertexId near = (dir == EdgeDirection::Outgoing ? old.source() : old.destination()).id();
+        const VertexId far = Graph::far_end(old, dir).id();
+        if (far >= state.pred.size() || state.get_pred(far) != near) continue;
+        bool still_tight = false;
+        for (const auto& e : G.get_edges(Vertex(near), dir)) {
+            if (Graph::far_end(e, dir).id() == far && state.get(near) + e.weight() == state.get(far)) {
+                still_tight = true;
+                break;
+            }
+        }
+        if (!still_tight) stack.push_back(far);
+    }
+    if (stack.empty()) return stats;
+
+    // Step 2: collect and reset the affected subtrees
+    const detail::ChildrenIndex index(state);
+    std::vector<char> affected(state.dist.size(), 0);
+    std::vector<VertexId> region;
+    while (!stack.empty()) {
+        const VertexId v = stack.back();
+        stack.pop_back();
+        if (affected[v]) continue;
+        affected[v] = 1;
+        region.push_back(v);
+        for (std::size_t i = index.offsets[v]; i < index.offsets[v + 1]; ++i) stack.push_back(index.children[i]);
+    }
+    for (VertexId v : region) {
+        state.set(v, INFINITE_WEIGHT);
+        state.set_pred(v, INVALID_VERTEX);
+    }
+    stats.affected = region.size();
+
+    // Step 3: seed from unaffected neighbours and re-settle
+    const EdgeDirection back = detail::opposite(dir);
+    for (VertexId v : region) {
+        for (const auto& e : G.get_edges(Vertex(v), back)) {
+            const VertexId u = Graph::far_end(e, back).id();
+            if (affected[u]) continue;
+            const Weight alt = state.get(u) + e.weight();
+            if (alt < state.get(v)) {
+                state.set(v, alt);
+                state.set_pred(v, u);
+            }
+        }
+        if (state.get(v) < INFINITE_WEIGHT) {
+            heap.insert(Vertex(v), state.get(v));
+            stats.seeds++;
+        }
+    }
+    while (!heap.empty()) {
+        auto [u, du] = heap.extract_min();
+        stats.improved++;
+        for (const auto& e : G.get_edges(u, dir)) {
+            const Vertex& v = Graph::far_end(e, dir);
+            const Weight alt = du + e.weight();
+            if (alt < state.get(v.id())) {
+                state.set(v.id(), alt);
+                state.set_pred(v.id(), u.id());
+                heap.insert(v, alt);
+            }
+        }
+    }
+    return stats;
+}
+
+inline RepairStats repairAfterIncrease(const Graph& G, DistState& state, const std::vector<Edge>& changed,
+                                       EdgeDirection dir = EdgeDirection::Outgoing) {
+    BinaryHeap heap;
+    return repairAfterIncrease(G, state, changed, dir, heap);
+}
+
+/**
+ * @brief Repair many maintained trees for the same batch of increases
+ */
+inline std::vector<RepairStats> repairAfterIncrease(const Graph& G, std::vector<DistState>& states,
+                                                    const std::vector<Edge>& changed,
+                                                    EdgeDirection dir = EdgeDirection::Outgoing,
+                                                    std::size_t num_threads = 0) {
+    std::vector<RepairStats> stats(states.size());
+    const std::size_t threads = resolve_threads(num_threads);
+    std::vector<BinaryHeap> heaps(threads);
+    parallel_for(states.size(), threads, [&](std::size_t i, std::size_t tid) {
+        stats[i] = repairAfterIncrease(G, states[i], changed, dir, heaps[tid]);
+    });
+    return stats;
+}
+
+} // namespace sssp
+
+#endif // SSSP_DYNAMIC_HPP
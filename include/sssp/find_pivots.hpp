@@ -15,6 +15,21 @@
 
 namespace sssp {
 
+/**
+ * @brief How FindPivots reduces a frontier S
+ *
+ * Every rule returns a valid pivot set, either the exact one of Algorithm 1
+ * or all of S, which is always safe. The heuristics only decide when the
+ * exact reduction is not worth its cost.
+ */
+enum class PivotRule {
+    Exact,       // Algorithm 1: k rounds, pivots are roots of trees with >= k vertices
+    Projected,   // stop the rounds once the growth rate projects |W| > k|S|; P = S
+    Sampled,     // follow the trees of sampled roots during the rounds; stop with
+                 // P = S once most are projected to reach k vertices
+    SkipSmall    // no rounds when |S| <= k; P = W = S
+};
+
 /**
  * @brief FindPivots procedure for frontier reduction (Algorithm 1 from paper)
  * 
@@ -32,6 +47,8 @@ public:
     struct Result {
         std::unordered_set<Vertex> P;  // Set of pivots P ⊆ S, |P| ≤ |W|/k
         std::unordered_set<Vertex> W;  // Set of vertices W ⊆ Ũ which are complete
+        std::size_t rounds = 0;        // relaxation rounds actually run
+        bool early_exit = false;       // stopped with P = S because W grew too large
         
         Result() = default;
     };
@@ -42,11 +59,13 @@ public:
     struct VertexState {
         Weight distance;
         Vertex predecessor;
+        Vertex root;            // root in S of the tree holding this vertex (Sampled only)
         bool has_predecessor;
         bool in_W;
         
         VertexState() : distance(std::numeric_limits<Weight>::infinity()),
                         predecessor(0),
+                        root(0),
                         has_predecessor(false),
                         in_W(false) {}
     };
@@ -59,6 +78,8 @@ public:
      * @param S Set of frontier vertices
      * @param k Number of relaxation steps
      * @param d_hat Current distance estimates (global state)
+     * @param dir Edge direction to relax (Incoming searches the reverse graph)
+     * @param rule Frontier reduction strategy (see PivotRule)
      * @return Result containing pivots P and complete vertices W
      * 
      * Time Complexity: O(min{k²|S|, k|Ũ|})
@@ -67,14 +88,24 @@ public:
                            Weight B,
                            const std::unordered_set<Vertex>& S,
                            std::size_t k,
-                           DistState& global) {
+                           DistState& global,
+                           EdgeDirection dir = EdgeDirection::Outgoing,
+                           PivotRule rule = PivotRule::Exact) {
 #ifdef SSSP_PROFILE
         ScopeTimer timer(&prof().findpivots_ns);
+        prof().pivot_calls++;
+        prof().pivot_frontier += S.size();
 #endif
         Result result;
         
         // Step 1: Initialize W ← S and W₀ ← S
         result.W = S;
+        if (rule == PivotRule::SkipSmall && S.size() <= k) {
+            // Rounds on a tiny frontier redo work the recursive call repeats
+            result.P = S;
+            finish(result);
+            return result;
+        }
         std::unordered_set<Vertex> W_prev = S;
         
         // Track local state for vertices
@@ -83,8 +114,18 @@ public:
         // Initialize distances for vertices in S
         for (const auto& v : S) {
             local[v].distance = global.get(v.id());
+            local[v].root = v;
             local[v].in_W = true;
         }
+        // Sampled: growth of the trees under an evenly spaced sample of S
+        std::unordered_map<Vertex, TreeGrowth> sampled;
+        if (rule == PivotRule::Sampled) {
+            const std::size_t stride = std::max<std::size_t>(1, S.size() / kPivotSamples);
+            std::size_t i = 0;
+            for (const auto& v : S) {
+                if (i++ % stride == 0) sampled[v] = TreeGrowth{};
+            }
+        }
         
         // Step 2: Perform k steps of relaxation
         for (std::size_t step = 0; step < k; ++step) {
@@ -93,8 +134,8 @@ public:
             // Relax edges from vertices in W_{i-1}
             for (const auto& u : W_prev) {
                 if (!graph.has_vertex(u)) continue;
-                for (const auto& edge : graph.get_outgoing_edges(u)) {
-                    Vertex v = edge.destination();
+                for (const auto& edge : graph.get_edges(u, dir)) {
+                    Vertex v = Graph::far_end(edge, dir);
                     Weight new_dist = local[u].distance + edge.weight();
                     if (new_dist < B) {
                         bool needs_update = false;
@@ -104,6 +145,7 @@ public:
                             local[v].distance = new_dist;
                             local[v].predecessor = u;
                             local[v].has_predecessor = true;
+                            if (!sampled.empty()) move_to_tree(local[v], local[u].root, sampled);
                             if (!local[v].in_W) {
                                 W_current.insert(v);
                                 local[v].in_W = true;
@@ -118,10 +160,18 @@ public:
                 result.W.insert(v);
             }
             
-            // Step 3: Check if |W| exceeds k|S|
-            if (result.W.size() > k * S.size()) {
+            result.rounds = step + 1;
+
+            // Step 3: Check if |W| exceeds k|S|, or is projected to, or most
+            // sampled roots are projected to become pivots
+            if (result.W.size() > k * S.size() ||
+                (rule == PivotRule::Projected &&
+                 projected_size(result.W.size(), W_prev.size(), W_current.size(), k - step - 1) > k * S.size()) ||
+                (rule == PivotRule::Sampled && 2 * projected_pivots(sampled, k, k - step - 1) > sampled.size())) {
                 // Return immediately with P = S
                 result.P = S;
+                result.early_exit = true;
+                finish(result);
                 return result;
             }
             
@@ -178,14 +228,90 @@ public:
             if (vstate.in_W) {
                 if (vstate.distance < global.get(v.id())) {
                     global.set(v.id(), vstate.distance);
+                    if (vstate.has_predecessor) global.set_pred(v.id(), vstate.predecessor.id());
                 }
             }
         }
         
+        finish(result);
         return result;
     }
     
 private:
+    // Roots followed by the Sampled rule
+    static constexpr std::size_t kPivotSamples = 32;
+
+    static void finish(const Result& result) {
+#ifdef SSSP_PROFILE
+        prof().pivot_rounds += result.rounds;
+        prof().pivots += result.P.size();
+        if (result.early_exit) prof().pivot_early_exits++;
+#else
+        (void)result;
+#endif
+    }
+
+    /**
+     * @brief |W| after `remaining` more rounds if the frontier keeps growing
+     *
+     * The last round took the frontier from `prev` to `cur` vertices; the
+     * projection assumes that ratio holds for the remaining rounds.
+     */
+    static double projected_size(std::size_t W, std::size_t prev, std::size_t cur, std::size_t remaining) {
+        const double growth = (double)cur / (double)std::max<std::size_t>(prev, 1);
+        double total = (double)W, frontier = (double)cur;
+        for (std::size_t i = 0; i < remaining && frontier >= 1.0; ++i) {
+            frontier *= growth;
+            total += frontier;
+        }
+        return total;
+    }
+
+    /**
+     * @brief Size of one sampled tree and how many vertices joined it per round
+     */
+    struct TreeGrowth {
+        std::size_t size = 1;       // the root
+        std::size_t prev = 1;       // joined in the previous round (round 0: the root)
+        std::size_t cur = 0;        // joined in the current round
+    };
+
+    /**
+     * @brief Move v into the tree of `root`, updating the sampled counts
+     *
+     * Descendants of a re-parented vertex keep their old root; the counts
+     * are an estimate either way.
+     */
+    static void move_to_tree(VertexState& v, const Vertex& root, std::unordered_map<Vertex, TreeGrowth>& sampled) {
+        if (v.in_W) {
+            auto old = sampled.find(v.root);
+            if (old != sampled.end() && old->second.size > 1) old->second.size--;
+        }
+        v.root = root;
+        auto it = sampled.find(root);
+        if (it != sampled.end()) {
+            it->second.size++;
+            it->second.cur++;
+        }
+    }
+
+    /**
+     * @brief Sampled roots whose tree is projected to reach k vertices
+     *
+     * Each tree keeps the growth ratio of its last round for the remaining
+     * rounds (see projected_size). Also starts the next round's counts.
+     */
+    static std::size_t projected_pivots(std::unordered_map<Vertex, TreeGrowth>& sampled, std::size_t k,
+                                        std::size_t remaining) {
+        std::size_t pivots = 0;
+        for (auto& [root, tree] : sampled) {
+            if (projected_size(tree.size, tree.prev, tree.cur, remaining) >= (double)k) pivots++;
+            tree.prev = tree.cur;
+            tree.cur = 0;
+        }
+        return pivots;
+    }
+
     /**
      * @brief Count the size of a tree rooted at given vertex
      * 
@@ -9,6 +9,7 @@
 #include <unordered_set>
 #include <memory>
 #include <algorithm>
+#include <atomic>
 #include <stdexcept>
 
 namespace sssp {
@@ -53,6 +54,7 @@ public:
             outgoing_edges_[v] = EdgeList();
             incoming_edges_[v] = EdgeList();
             num_vertices_++;
+            topo_cache_.reset();
         }
     }
     
@@ -77,11 +79,20 @@ public:
         // Create edge with unique ID
         Edge edge_with_id(next_edge_id_++, e.source(), e.destination(), e.weight());
         
+        // Track whether all edges share one weight (unit-weight fast path)
+        if (num_edges_ == 0) {
+            uniform_weight_ = e.weight();
+            has_uniform_weights_ = true;
+        } else if (e.weight() != uniform_weight_) {
+            has_uniform_weights_ = false;
+        }
+        
         // Add to adjacency lists
         outgoing_edges_[e.source()].push_back(edge_with_id);
         incoming_edges_[e.destination()].push_back(edge_with_id);
         edges_.push_back(edge_with_id);
         num_edges_++;
+        topo_cache_.reset();
     }
     
     void add_edge(const Vertex& source, const Vertex& destination, Weight weight) {
@@ -92,6 +103,43 @@ public:
         add_edge(Vertex(source_id), Vertex(destination_id), weight);
     }
     
+    // Edge lookup by id
+    [[nodiscard]] const Edge& edge(EdgeId id) const {
+        return *find_edge(id);
+    }
+    
+    // Change the weight of an existing edge in place (all adjacency copies)
+    void set_edge_weight(EdgeId id, Weight weight) {
+        Edge& e = *find_edge(id);
+        e.set_weight(weight);
+        if (weight != uniform_weight_) has_uniform_weights_ = false;
+        for (auto& x : outgoing_edges_[e.source()]) {
+            if (x.id() == id) x.set_weight(weight);
+        }
+        for (auto& x : incoming_edges_[e.destination()]) {
+            if (x.id() == id) x.set_weight(weight);
+        }
+    }
+    
+    // Remove an edge; ids of the remaining edges are not renumbered
+    void remove_edge(EdgeId id) {
+        auto it = find_edge(id);
+        const EdgeId eid = it->id();
+        auto drop = [eid](EdgeList& list) {
+            list.erase(std::remove_if(list.begin(), list.end(),
+                                      [eid](const Edge& x) { return x.id() == eid; }),
+                       list.end());
+        };
+        drop(outgoing_edges_[it->source()]);
+        drop(incoming_edges_[it->destination()]);
+        edges_.erase(it);
+        num_edges_--;
+        topo_cache_.reset();
+    }
+    
+    // One past the largest edge id ever assigned; size for id-indexed columns
+    [[nodiscard]] EdgeId edge_id_bound() const noexcept { return next_edge_id_; }
+    
     // Adjacency list retrieval
     [[nodiscard]] const EdgeList& get_outgoing_edges(const Vertex& v) const {
         auto it = outgoing_edges_.find(v);
@@ -119,6 +167,34 @@ public:
         return get_incoming_edges(Vertex(id));
     }
     
+    // Direction-aware adjacency: edges leaving v when traversed in dir
+    [[nodiscard]] const EdgeList& get_edges(const Vertex& v, EdgeDirection dir) const {
+        return dir == EdgeDirection::Outgoing ? get_outgoing_edges(v) : get_incoming_edges(v);
+    }
+    
+    // Endpoint reached by traversing e in dir
+    [[nodiscard]] static const Vertex& far_end(const Edge& e, EdgeDirection dir) noexcept {
+        return dir == EdgeDirection::Outgoing ? e.destination() : e.source();
+    }
+    
+    // True if the graph has edges and all of them carry the same weight.
+    // Maintained on insertion; weight updates can only clear it, so it may
+    // stay false after a graph becomes uniform again.
+    [[nodiscard]] bool has_uniform_weights() const noexcept {
+        return num_edges_ > 0 && has_uniform_weights_;
+    }
+    
+    // The common edge weight; meaningful only if has_uniform_weights()
+    [[nodiscard]] Weight uniform_weight() const noexcept { return uniform_weight_; }
+    
+    // True if the graph has no directed cycle (self-loops count as cycles).
+    // Computed once and cached until the next structural change; weight
+    // updates keep the cache.
+    [[nodiscard]] bool is_acyclic() const { return topology().acyclic; }
+    
+    // Vertex ids in topological order; empty if the graph has a cycle
+    [[nodiscard]] const std::vector<VertexId>& topological_order() const { return topology().order; }
+    
     // Graph properties
     [[nodiscard]] std::size_t num_vertices() const noexcept { return num_vertices_; }
     [[nodiscard]] std::size_t num_edges() const noexcept { return num_edges_; }
@@ -162,6 +238,9 @@ public:
         num_vertices_ = 0;
         num_edges_ = 0;
         next_edge_id_ = 0;
+        uniform_weight_ = 0.0;
+        has_uniform_weights_ = false;
+        topo_cache_.reset();
     }
     
     // Get algorithm parameters
@@ -184,6 +263,59 @@ public:
     [[nodiscard]] edge_iterator edges_end() const noexcept { return edges_.end(); }
 
 private:
+    // edges_ is sorted by id; it is indexed by id until an edge is removed
+    std::vector<Edge>::iterator find_edge(EdgeId id) {
+        if (id < edges_.size() && edges_[id].id() == id) {
+            return edges_.begin() + static_cast<std::ptrdiff_t>(id);
+        }
+        auto it = std::lower_bound(edges_.begin(), edges_.end(), id,
+                                   [](const Edge& e, EdgeId x) { return e.id() < x; });
+        if (it == edges_.end() || it->id() != id) {
+            throw std::invalid_argument("Unknown edge id");
+        }
+        return it;
+    }
+    
+    std::vector<Edge>::const_iterator find_edge(EdgeId id) const {
+        return const_cast<Graph*>(this)->find_edge(id);
+    }
+    
+    struct Topology {
+        bool acyclic = false;
+        std::vector<VertexId> order;
+    };
+    
+    // Lazily computed with Kahn's algorithm. Concurrent const callers may
+    // both compute it, but only the first result is published, so returned
+    // references stay valid until the graph is modified.
+    const Topology& topology() const {
+        auto cached = std::atomic_load(&topo_cache_);
+        if (cached) return *cached;
+        
+        auto topo = std::make_shared<Topology>();
+        VertexId bound = 0;
+        for (const auto& v : vertices_) bound = std::max(bound, v.id() + 1);
+        std::vector<std::size_t> in_degree(bound, 0);
+        for (const auto& e : edges_) in_degree[e.destination().id()]++;
+        auto& order = topo->order;
+        order.reserve(num_vertices_);
+        for (const auto& v : vertices_) {
+            if (in_degree[v.id()] == 0) order.push_back(v.id());
+        }
+        for (std::size_t head = 0; head < order.size(); ++head) {
+            for (const auto& e : get_outgoing_edges(Vertex(order[head]))) {
+                if (--in_degree[e.destination().id()] == 0) order.push_back(e.destination().id());
+            }
+        }
+        topo->acyclic = order.size() == num_vertices_;
+        if (!topo->acyclic) order.clear();
+        
+        std::shared_ptr<const Topology> expected;
+        std::shared_ptr<const Topology> desired = std::move(topo);
+        if (std::atomic_compare_exchange_strong(&topo_cache_, &expected, desired)) return *desired;
+        return *expected;
+    }
+    
     VertexSet vertices_;                    // Set of all vertices
     std::vector<Edge> edges_;               // List of all edges
     AdjacencyList outgoing_edges_;         // Outgoing edges for each vertex
@@ -191,6 +323,9 @@ private:
     std::size_t num_vertices_;             // Number of vertices
     std::size_t num_edges_;                // Number of edges
     EdgeId next_edge_id_;                  // Next available edge ID
+    Weight uniform_weight_ = 0.0;          // Weight of the first edge
+    bool has_uniform_weights_ = false;     // All edges share uniform_weight_
+    mutable std::shared_ptr<const Topology> topo_cache_;   // See topology()
 };
 
 } // namespace sssp
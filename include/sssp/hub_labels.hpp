@@ -0,0 +1,320 @@
+#ifndef SSSP_HUB_LABELS_HPP
+#define SSSP_HUB_LABELS_HPP
+
+#include "sssp/types.hpp"
+#include "sssp/graph.hpp"
+#include "sssp/binary_heap.hpp"
+#include "sssp/parallel.hpp"
+#include <vector>
+#include <string>
+#include <fstream>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <numeric>
+#include <algorithm>
+#include <stdexcept>
+
+namespace sssp {
+
+struct HubLabelBuildOptions {
+    std::size_t num_threads = 0;    // 0 = hardware concurrency
+    std::size_t max_batch = 0;      // hubs processed concurrently; 0 = number of threads
+};
+
+/**
+ * @brief Hub labeling built with pruned landmark labeling (PLL)
+ *
+ * Every vertex v stores an out-label {(h, d(v, h))} and an in-label
+ * {(h, d(h, v))} such that for every pair (s, t) some hub on a shortest
+ * s-t path appears in both out(s) and in(t). A distance query is then a
+ * merge-join of two labels sorted by hub rank.
+ *
+ * Labels are built by running, for each hub in the given order, a forward
+ * and a backward Dijkstra that prune every vertex whose distance is already
+ * answered by the labels built so far. Hubs are processed in batches whose
+ * searches run in parallel against the labels of earlier batches; this only
+ * weakens pruning inside a batch (labels may get slightly larger), never
+ * correctness. Batches start at a single hub and double up to max_batch,
+ * since the first hubs prune the most.
+ *
+ * Storage is flat structure-of-arrays: per direction one offsets array, one
+ * uint32 hub-rank array and one distance array. Each label ends with a
+ * sentinel hub so the merge loop needs no bounds checks.
+ */
+class HubLabels {
+public:
+    struct MemoryReport {
+        std::size_t num_vertices;
+        std::size_t out_entries;        // excluding sentinels
+        std::size_t in_entries;
+        std::size_t max_label_size;
+        double avg_out_label_size;
+        double avg_in_label_size;
+        std::size_t bytes;              // offsets + hubs + distances
+    };
+
+    /**
+     * @brief Vertices by decreasing total degree (ties by id)
+     */
+    static std::vector<VertexId> degree_order(const Graph& G) {
+        std::vector<VertexId> order(G.num_vertices());
+        std::iota(order.begin(), order.end(), VertexId(0));
+        std::vector<std::size_t> deg(order.size());
+        for (VertexId v = 0; v < order.size(); ++v) deg[v] = G.degree(Vertex(v));
+        std::stable_sort(order.begin(), order.end(),
+                         [&](VertexId a, VertexId b) { return deg[a] > deg[b]; });
+        return order;
+    }
+
+    /**
+     * @brief Vertices by decreasing rank, e.g. ContractionHierarchy::ranks()
+     */
+    static std::vector<VertexId> order_from_ranks(const std::vector<std::size_t>& ranks) {
+        std::vector<VertexId> order(ranks.size());
+        std::iota(order.begin(), order.end(), VertexId(0));
+        std::sort(order.begin(), order.end(),
+                  [&](VertexId a, VertexId b) { return ranks[a] > ranks[b]; });
+        return order;
+    }
+
+    static HubLabels build(const Graph& G, const HubLabelBuildOptions& opts = HubLabelBuildOptions()) {
+        return build(G, degree_order(G), opts);
+    }
+
+    /**
+     * @brief Build labels using order[0] as the most important hub
+     */
+    static HubLabels build(const Graph& G, const std::vector<VertexId>& order,
+                           const HubLabelBuildOptions& opts = HubLabelBuildOptions()) {
+        const std::size_t n = G.num_vertices();
+        if (order.size() != n) throw std::invalid_argument("Hub order must list every vertex once");
+        if (n >= SENTINEL) throw std::invalid_argument("Too many vertices for 32-bit hub ranks");
+
+        const std::size_t threads = resolve_threads(opts.num_threads);
+        const std::size_t max_batch = opts.max_batch > 0 ? opts.max_batch : threads;
+
+        std::vector<std::vector<Entry>> out_lab(n), in_lab(n);
+        std::vector<Workspace> workspaces(threads);
+        for (auto& ws : workspaces) ws.init(n);
+
+        std::vector<std::vector<std::pair<VertexId, Weight>>> found_in, found_out;
+        std::size_t batch = 1;
+        for (std::size_t first = 0; first < n; first += batch, batch = std::min(batch * 2, max_batch)) {
+            const std::size_t count = std::min(batch, n - first);
+            found_in.assign(count, {});
+            found_out.assign(count, {});
+            parallel_for(count, threads, [&](std::size_t i, std::size_t tid) {
+                const auto rank = static_cast<std::uint32_t>(first + i);
+                pruned_search(G, order[rank], true, out_lab, in_lab, workspaces[tid], found_in[i]);
+                pruned_search(G, order[rank], false, in_lab, out_lab, workspaces[tid], found_out[i]);
+            });
+            // Commit in rank order so every label stays sorted by hub rank
+            for (std::size_t i = 0; i < count; ++i) {
+                const auto rank = static_cast<std::uint32_t>(first + i);
+                for (const auto& [v, d] : found_in[i]) in_lab[v].push_back({rank, d});
+                for (const auto& [v, d] : found_out[i]) out_lab[v].push_back({rank, d});
+            }
+        }
+
+        HubLabels hl;
+        hl.n_ = n;
+        flatten(out_lab, hl.out_offsets_, hl.out_hubs_, hl.out_dists_);
+        flatten(in_lab, hl.in_offsets_, hl.in_hubs_, hl.in_dists_);
+        return hl;
+    }
+
+    /**
+     * @brief d(s, t) by merge-joining out(s) and in(t)
+     */
+    Weight query(VertexId s, VertexId t) const {
+        if (s >= n_ || t >= n_) return INFINITE_WEIGHT;
+        const std::uint32_t* hs = &out_hubs_[out_offsets_[s]];
+        const Weight* ds = &out_dists_[out_offsets_[s]];
+        const std::uint32_t* ht = &in_hubs_[in_offsets_[t]];
+        const Weight* dt = &in_dists_[in_offsets_[t]];
+        Weight best = INFINITE_WEIGHT;
+        std::size_t i = 0, j = 0;
+        while (true) {
+            const std::uint32_t a = hs[i], b = ht[j];
+            if (a == b) {
+                if (a == SENTINEL) break;
+                best = std::min(best, ds[i] + dt[j]);
+            }
+            i += (a <= b);
+            j += (b <= a);
+        }
+        return best;
+    }
+
+    Weight query(const Vertex& s, const Vertex& t) const { return query(s.id(), t.id()); }
+
+    MemoryReport memory_report() const {
+        MemoryReport r{};
+        r.num_vertices = n_;
+        r.out_entries = out_hubs_.size() - n_;
+        r.in_entries = in_hubs_.size() - n_;
+        for (std::size_t v = 0; v < n_; ++v) {
+            r.max_label_size = std::max<std::size_t>(r.max_label_size, out_offsets_[v + 1] - out_offsets_[v] - 1);
+            r.max_label_size = std::max<std::size_t>(r.max_label_size, in_offsets_[v + 1] - in_offsets_[v] - 1);
+        }
+        r.avg_out_label_size = n_ ? static_cast<double>(r.out_entries) / n_ : 0.0;
+        r.avg_in_label_size = n_ ? static_cast<double>(r.in_entries) / n_ : 0.0;
+        r.bytes = (out_offsets_.size() + in_offsets_.size()) * sizeof(std::uint64_t) +
+                  (out_hubs_.size() + in_hubs_.size()) * sizeof(std::uint32_t) +
+                  (out_dists_.size() + in_dists_.size()) * sizeof(Weight);
+        return r;
+    }
+
+    void save(const std::string& path) const {
+        std::ofstream out(path, std::ios::binary);
+        if (!out) throw std::runtime_error("Cannot open hub label file for writing: " + path);
+        const std::uint64_t header[4] = {FORMAT_VERSION, n_, out_hubs_.size(), in_hubs_.size()};
+        out.write(MAGIC, sizeof(MAGIC));
+        out.write(reinterpret_cast<const char*>(header), sizeof(header));
+        write_vector(out, out_offsets_);
+        write_vector(out, out_hubs_);
+        write_vector(out, out_dists_);
+        write_vector(out, in_offsets_);
+        write_vector(out, in_hubs_);
+        write_vector(out, in_dists_);
+        if (!out) throw std::runtime_error("Failed to write hub label file: " + path);
+    }
+
+    static HubLabels load(const std::string& path) {
+        std::ifstream in(path, std::ios::binary);
+        if (!in) throw std::runtime_error("Cannot open hub label file: " + path);
+        char magic[sizeof(MAGIC)];
+        std::uint64_t header[4];
+        in.read(magic, sizeof(magic));
+        in.read(reinterpret_cast<char*>(header), sizeof(header));
+        if (!in || std::memcmp(magic, MAGIC, sizeof(MAGIC)) != 0 || header[0] != FORMAT_VERSION) {
+            throw std::runtime_error("Not a hub label file: " + path);
+        }
+        HubLabels hl;
+        hl.n_ = header[1];
+        read_vector(in, hl.out_offsets_, hl.n_ + 1);
+        read_vector(in, hl.out_hubs_, header[2]);
+        read_vector(in, hl.out_dists_, header[2]);
+        read_vector(in, hl.in_offsets_, hl.n_ + 1);
+        read_vector(in, hl.in_hubs_, header[3]);
+        read_vector(in, hl.in_dists_, header[3]);
+        if (!in) throw std::runtime_error("Truncated hub label file: " + path);
+        return hl;
+    }
+
+    [[nodiscard]] std::size_t num_vertices() const noexcept { return n_; }
+
+private:
+    static constexpr std::uint32_t SENTINEL = std::numeric_limits<std::uint32_t>::max();
+    static constexpr char MAGIC[8] = {'S', 'S', 'S', 'P', 'H', 'L', '\0', '\0'};
+    static constexpr std::uint64_t FORMAT_VERSION = 1;
+
+    struct Entry {
+        std::uint32_t hub;   // hub rank
+        Weight dist;
+    };
+
+    /**
+     * @brief Per-thread scratch space for pruned searches
+     *
+     * hub_dist holds the root's label indexed by hub rank while a search
+     * runs, so the pruning test for v costs O(|label(v)|).
+     */
+    struct Workspace {
+        std::vector<Weight> dist;
+        std::vector<Weight> hub_dist;
+        std::vector<VertexId> touched;
+        BinaryHeap heap;
+
+        void init(std::size_t n) {
+            dist.assign(n, INFINITE_WEIGHT);
+            hub_dist.assign(n, INFINITE_WEIGHT);
+        }
+    };
+
+    std::size_t n_ = 0;
+    std::vector<std::uint64_t> out_offsets_{0};
+    std::vector<std::uint32_t> out_hubs_;
+    std::vector<Weight> out_dists_;
+    std::vector<std::uint64_t> in_offsets_{0};
+    std::vector<std::uint32_t> in_hubs_;
+    std::vector<Weight> in_dists_;
+
+    /**
+     * @brief Pruned Dijkstra from hub h
+     *
+     * forward = true walks outgoing edges and reports (v, d(h, v)) for the
+     * in-labels, checking out(h) against in(v); forward = false walks
+     * incoming edges for the out-labels. root_side is the label family of h
+     * used for pruning, far_side the one of the reached vertices.
+     */
+    static void pruned_search(const Graph& G, VertexId h, bool forward,
+                              const std::vector<std::vector<Entry>>& root_side,
+                              const std::vector<std::vector<Entry>>& far_side,
+                              Workspace& ws, std::vector<std::pair<VertexId, Weight>>& found) {
+        for (const auto& e : root_side[h]) ws.hub_dist[e.hub] = e.dist;
+        ws.heap.clear();
+        ws.dist[h] = 0.0;
+        ws.touched.push_back(h);
+        ws.heap.insert(Vertex(h), 0.0);
+
+        while (!ws.heap.empty()) {
+            auto [uv, du] = ws.heap.extract_min();
+            const VertexId u = uv.id();
+            bool covered = false;
+            for (const auto& e : far_side[u]) {
+                if (ws.hub_dist[e.hub] + e.dist <= du) { covered = true; break; }
+            }
+            if (covered) continue;
+            found.emplace_back(u, du);
+            const auto& edges = forward ? G.get_outgoing_edges(uv) : G.get_incoming_edges(uv);
+            for (const auto& e : edges) {
+                const VertexId v = forward ? e.destination().id() : e.source().id();
+                const Weight alt = du + e.weight();
+                if (alt < ws.dist[v]) {
+                    if (ws.dist[v] == INFINITE_WEIGHT) ws.touched.push_back(v);
+                    ws.dist[v] = alt;
+                    ws.heap.insert(Vertex(v), alt);
+                }
+            }
+        }
+
+        for (VertexId v : ws.touched) ws.dist[v] = INFINITE_WEIGHT;
+        ws.touched.clear();
+        for (const auto& e : root_side[h]) ws.hub_dist[e.hub] = INFINITE_WEIGHT;
+    }
+
+    static void flatten(const std::vector<std::vector<Entry>>& labels, std::vector<std::uint64_t>& offsets,
+                        std::vector<std::uint32_t>& hubs, std::vector<Weight>& dists) {
+        offsets.assign(labels.size() + 1, 0);
+        for (std::size_t v = 0; v < labels.size(); ++v) offsets[v + 1] = offsets[v] + labels[v].size() + 1;
+        hubs.clear();
+        dists.clear();
+        hubs.reserve(offsets.back());
+        dists.reserve(offsets.back());
+        for (const auto& l : labels) {
+            for (const auto& e : l) {
+                hubs.push_back(e.hub);
+                dists.push_back(e.dist);
+            }
+            hubs.push_back(SENTINEL);
+            dists.push_back(INFINITE_WEIGHT);
+        }
+    }
+
+    template <class T>
+    static void write_vector(std::ofstream& out, const std::vector<T>& v) {
+        out.write(reinterpret_cast<const char*>(v.data()), v.size() * sizeof(T));
+    }
+
+    template <class T>
+    static void read_vector(std::ifstream& in, std::vector<T>& v, std::size_t count) {
+        v.resize(count);
+        in.read(reinterpret_cast<char*>(v.data()), count * sizeof(T));
+    }
+};
+
+} // namespace sssp
+
+#endif // SSSP_HUB_LABELS_HPP
@@ -0,0 +1,259 @@
+#ifndef SSSP_K_SHORTEST_PATHS_HPP
+#define SSSP_K_SHORTEST_PATHS_HPP
+
+#include "sssp/types.hpp"
+#include "sssp/graph.hpp"
+#include "sssp/binary_heap.hpp"
+#include "sssp/api.hpp"
+#include <vector>
+#include <set>
+#include <cstdint>
+#include <algorithm>
+
+namespace sssp {
+
+struct KShortestPath {
+    Weight distance;
+    std::vector<Vertex> path;     // source ... target
+    std::vector<EdgeId> edges;    // path[i] -> path[i + 1] is edges[i]
+};
+
+struct KShortestResult {
+    std::vector<KShortestPath> paths;   // by non-decreasing distance, at most k
+    std::size_t spur_searches = 0;      // spur searches actually run
+    std::size_t pruned_spurs = 0;       // spurs skipped by the lower bound
+    std::size_t settled = 0;            // vertices settled over all spur searches
+};
+
+/**
+ * @brief k shortest loopless s-t paths (Yen's algorithm)
+ *
+ * Candidates are generated as in Yen: for every vertex of the last accepted
+ * path, the root prefix up to it is kept and a spur path to the target is
+ * searched with the root's vertices and the next edges of all accepted
+ * paths sharing that root removed. Removal uses stamped vertex and edge
+ * masks instead of graph copies.
+ *
+ * Spur searches are A* toward the target, using the exact distances to the
+ * target in the unmasked graph (one solveReverseSSSP per target) as the
+ * potential. Masks only remove edges, so the potential stays a valid lower
+ * bound; it also prunes whole spurs: if root cost plus the best unmasked
+ * first edge plus its remaining distance cannot beat the candidates already
+ * queued, the spur is skipped without a search. All searches share one
+ * workspace that is reset sparsely through a touched list.
+ *
+ * The engine keeps a flat copy of G's adjacency; G must not change while it
+ * is in use. Vertex ids are assumed dense in [0, n).
+ */
+class KShortestPaths {
+public:
+    explicit KShortestPaths(const Graph& G) : G_(G), n_(G.num_vertices()) {
+        offsets_.assign(n_ + 1, 0);
+        heads_.reserve(G.num_edges());
+        weights_.reserve(G.num_edges());
+        ids_.reserve(G.num_edges());
+        for (VertexId u = 0; u < n_; ++u) {
+            for (const auto& e : G.get_outgoing_edges(u)) {
+                heads_.push_back(e.destination().id());
+                weights_.push_back(e.weight());
+                ids_.push_back(e.id());
+            }
+            offsets_[u + 1] = heads_.size();
+        }
+        dist_.assign(n_, INFINITE_WEIGHT);
+        pred_arc_.assign(n_, NO_ARC);
+        vertex_mask_.assign(n_, 0);
+        edge_mask_.assign(G.edge_id_bound(), 0);
+    }
+
+    KShortestResult query(const Vertex& source, const Vertex& target, std::size_t k) {
+        KShortestResult res;
+        if (k == 0 || source.id() >= n_ || target.id() >= n_) return res;
+        prepare_target(target.id());
+        const VertexId s = source.id(), t = target.id();
+        if (to_target_.get(s) == INFINITE_WEIGHT) return res;
+
+        // First path: follow the reverse tree's successors
+        KShortestPath first{to_target_.get(s), {Vertex(s)}, {}};
+        for (VertexId v = s; v != t;) {
+            const VertexId next = to_target_.get_pred(v);
+            first.edges.push_back(ids_[cheapest_arc(v, next)]);
+            first.path.push_back(Vertex(next));
+            v = next;
+        }
+        res.paths.push_back(std::move(first));
+
+        std::vector<KShortestPath> candidates;   // sorted by distance
+        std::set<std::vector<EdgeId>> seen = {res.paths[0].edges};
+        while (res.paths.size() < k) {
+            const KShortestPath last = res.paths.back();
+            const std::size_t needed = k - res.paths.size();
+            Weight root_cost = 0.0;
+            for (std::size_t i = 0; i + 1 < last.path.size(); ++i) {
+                const VertexId spur = last.path[i].id();
+                next_epoch();
+                for (std::size_t j = 0; j < i; ++j) vertex_mask_[last.path[j].id()] = epoch_;
+                for (const auto& p : res.paths) {
+                    if (p.edges.size() > i && std::equal(last.edges.begin(), last.edges.begin() + i, p.edges.begin())) {
+                        edge_mask_[p.edges[i]] = epoch_;
+                    }
+                }
+
+                // Only candidates that could still make the top k matter
+                const Weight bound = candidates.size() >= needed ? candidates[needed - 1].distance : INFINITE_WEIGHT;
+                if (root_cost + spur_lower_bound(spur) >= bound) {
+                    res.pruned_spurs++;
+                } else {
+                    res.spur_searches++;
+                    std::vector<std::size_t> arcs;
+                    const Weight spur_cost = spur_search(spur, t, bound - root_cost, arcs, res.settled);
+                    if (spur_cost < INFINITE_WEIGHT) {
+                        KShortestPath cand{root_cost + spur_cost,
+                                           {last.path.begin(), last.path.begin() + static_cast<std::ptrdiff_t>(i + 1)},
+                                           {last.edges.begin(), last.edges.begin() + static_cast<std::ptrdiff_t>(i)}};
+                        for (std::size_t a : arcs) {
+                            cand.edges.push_back(ids_[a]);
+                            cand.path.push_back(Vertex(heads_[a]));
+                        }
+                        if (seen.insert(cand.edges).second) {
+                            auto pos = std::upper_bound(candidates.begin(), candidates.end(), cand.distance,
+                                                        [](Weight d, const KShortestPath& p) { return d < p.distance; });
+                            candidates.insert(pos, std::move(cand));
+                        }
+                    }
+                }
+                root_cost += G_.edge(last.edges[i]).weight();
+            }
+            if (candidates.empty()) break;
+            res.paths.push_back(std::move(candidates.front()));
+            candidates.erase(candidates.begin());
+        }
+        return res;
+    }
+
+private:
+    static constexpr std::size_t NO_ARC = static_cast<std::size_t>(-1);
+
+    const Graph& G_;
+    std::size_t n_;
+    std::vector<std::size_t> offsets_;
+    std::vector<VertexId> heads_;
+    std::vector<Weight> weights_;
+    std::vector<EdgeId> ids_;
+
+    VertexId target_ = INVALID_VERTEX;
+    DistState to_target_;                 // exact distances to target_, pred = successor
+
+    // Spur-search workspace, reset through touched_
+    std::vector<Weight> dist_;
+    std::vector<std::size_t> pred_arc_;
+    std::vector<VertexId> touched_;
+    BinaryHeap heap_;
+
+    // A vertex or edge is masked iff its stamp equals epoch_
+    std::vector<std::uint32_t> vertex_mask_;
+    std::vector<std::uint32_t> edge_mask_;
+    std::uint32_t epoch_ = 0;
+
+    void prepare_target(VertexId t) {
+        if (t == target_) return;
+        solveReverseSSSP(G_, Vertex(t), to_target_);
+        target_ = t;
+    }
+
+    void next_epoch() {
+        if (++epoch_ == 0) {
+            std::fill(vertex_mask_.begin(), vertex_mask_.end(), 0);
+            std::fill(edge_mask_.begin(), edge_mask_.end(), 0);
+            epoch_ = 1;
+        }
+    }
+
+    bool usable(std::size_t a) const {
+        return edge_mask_[ids_[a]] != epoch_ && vertex_mask_[heads_[a]] != epoch_;
+    }
+
+    std::size_t cheapest_arc(VertexId u, VertexId v) const {
+        std::size_t best = NO_ARC;
+        for (std::size_t a = offsets_[u]; a < offsets_[u + 1]; ++a) {
+            if (heads_[a] == v && (best == NO_ARC || weights_[a] < weights_[best])) best = a;
+        }
+        return best;
+    }
+
+    // min over usable first edges of w + d(head, t): a lower bound on any
+    // spur path from u under the current masks
+    Weight spur_lower_bound(VertexId u) const {
+        Weight best = INFINITE_WEIGHT;
+        for (std::size_t a = offsets_[u]; a < offsets_[u + 1]; ++a) {
+            if (usable(a)) best = std::min(best, weights_[a] + to_target_.get(heads_[a]));
+        }
+        return best;
+    }
+
+    // A* from spur to t under the masks. Returns the spur cost (arcs filled
+    // in path order), or INFINITE_WEIGHT if none exists below limit.
+    Weight spur_search(VertexId spur, VertexId t, Weight limit, std::vector<std::size_t>& arcs,
+                       std::size_t& settled) {
+        Weight found = INFINITE_WEIGHT;
+        dist_[spur] = 0.0;
+        touched_.push_back(spur);
+        heap_.insert(Vertex(spur), to_target_.get(spur));
+        while (!heap_.empty()) {
+            auto [u, key] = heap_.extract_min();
+            if (key >= limit) break;
+            settled++;
+            if (u.id() == t) {
+                found = dist_[t];
+                break;
+            }
+            const Weight du = dist_[u.id()];
+            for (std::size_t a = offsets_[u.id()]; a < offsets_[u.id() + 1]; ++a) {
+                const VertexId v = heads_[a];
+                if (!usable(a) || to_target_.get(v) == INFINITE_WEIGHT) continue;
+                const Weight alt = du + weights_[a];
+                if (alt < dist_[v]) {
+                    if (dist_[v] == INFINITE_WEIGHT) touched_.push_back(v);
+                    dist_[v] = alt;
+                    pred_arc_[v] = a;
+                    heap_.insert(Vertex(v), alt + to_target_.get(v));
+                }
+            }
+        }
+
+        arcs.clear();
+        if (found < INFINITE_WEIGHT) {
+            for (VertexId v = t; v != spur;) {
+                const std::size_t a = pred_arc_[v];
+                arcs.push_back(a);
+                v = arc_tail(a);
+            }
+            std::reverse(arcs.begin(), arcs.end());
+        }
+
+        for (VertexId v : touched_) {
+            dist_[v] = INFINITE_WEIGHT;
+            pred_arc_[v] = NO_ARC;
+        }
+        touched_.clear();
+        heap_.clear();
+        return found;
+    }
+
+    VertexId arc_tail(std::size_t a) const {
+        // offsets_ is non-decreasing: the tail is the last u with offsets_[u] <= a
+        return static_cast<VertexId>(std::upper_bound(offsets_.begin(), offsets_.end(), a) - offsets_.begin() - 1);
+    }
+};
+
+/**
+ * @brief One-shot form of KShortestPaths::query
+ */
+inline KShortestResult kShortestPaths(const Graph& G, const Vertex& source, const Vertex& target, std::size_t k) {
+    KShortestPaths engine(G);
+    return engine.query(source, target, k);
+}
+
+} // namespace sssp
+
+#endif // SSSP_K_SHORTEST_PATHS_HPP
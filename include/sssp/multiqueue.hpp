@@ -0,0 +1,192 @@
+#ifndef SSSP_MULTIQUEUE_HPP
+#define SSSP_MULTIQUEUE_HPP
+
+#include "sssp/types.hpp"
+#include "sssp/graph.hpp"
+#include "sssp/parallel.hpp"
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace sssp {
+
+struct MultiQueueOptions {
+    std::size_t num_threads = 0;        // 0 = hardware concurrency
+    std::size_t queues_per_thread = 2;  // c: the engine keeps c * threads heaps
+    std::uint64_t seed = 1;             // queue choices are random per thread
+};
+
+/**
+ * @brief Parallel label-correcting SSSP over a relaxed MultiQueue
+ *
+ * The priority queue is c * p sequential binary heaps, each behind its own
+ * try-lock. A push goes to a random unlocked queue; a pop looks at the
+ * cached minima of two random queues and takes from the smaller one. The
+ * order is only approximately by distance, so a vertex may be settled more
+ * than once: a pop whose key is above the vertex's current distance is stale
+ * and is dropped, and a later improvement pushes the vertex again. The
+ * heaps therefore use lazy deletion (an improvement pushes a new copy, the
+ * old one goes stale) and need no position map, so memory is O(entries)
+ * rather than O(c * p * n). Unlike
+ * bucket methods there is no global phase barrier, which helps on
+ * high-diameter graphs such as road networks.
+ *
+ * Distances are atomics read without locks; an improvement takes a small
+ * per-vertex spinlock so dist and pred always change together. The search
+ * ends when no queue holds an entry and no thread is relaxing one.
+ *
+ * Output matches solveSSSP (dense dist and pred in the caller's DistState);
+ * dir = Incoming searches the reverse graph and yields successors.
+ */
+class MultiQueueSSSP {
+public:
+    static void run(const Graph& G, const Vertex& source, DistState& state,
+                    EdgeDirection dir = EdgeDirection::Outgoing,
+                    const MultiQueueOptions& opts = MultiQueueOptions()) {
+        const std::size_t n = G.num_vertices();
+        state.init(n);
+        if (source.id() >= n) return;
+
+        std::vector<std::size_t> offsets(n + 1, 0);
+        std::vector<VertexId> heads;
+        std::vector<Weight> weights;
+        heads.reserve(G.num_edges());
+        weights.reserve(G.num_edges());
+        for (VertexId u = 0; u < n; ++u) {
+            for (const auto& e : G.get_edges(Vertex(u), dir)) {
+                heads.push_back(Graph::far_end(e, dir).id());
+                weights.push_back(e.weight());
+            }
+            offsets[u + 1] = heads.size();
+        }
+
+        const std::size_t threads = resolve_threads(opts.num_threads);
+        const std::size_t num_queues = std::max<std::size_t>(2, threads * std::max<std::size_t>(opts.queues_per_thread, 1));
+        std::vector<Queue> queues(num_queues);
+        std::vector<std::atomic<Weight>> dist(n);
+        std::vector<std::atomic<bool>> vertex_lock(n);
+        for (VertexId v = 0; v < n; ++v) {
+            dist[v].store(INFINITE_WEIGHT, std::memory_order_relaxed);
+            vertex_lock[v].store(false, std::memory_order_relaxed);
+        }
+        // Entries in some queue plus entries a thread has popped but not yet relaxed
+        std::atomic<std::size_t> pending{0};
+
+        const VertexId s = source.id();
+        dist[s].store(0.0, std::memory_order_relaxed);
+        queues[0].heap.emplace_back(0.0, s);
+        queues[0].top.store(0.0, std::memory_order_relaxed);
+        pending.store(1, std::memory_order_relaxed);
+
+        auto worker = [&](std::size_t tid) {
+            std::uint64_t rng = opts.seed * 0x9E3779B97F4A7C15ull + tid + 1;
+            auto pick = [&]() { return static_cast<std::size_t>(next_random(rng) % num_queues); };
+
+            while (true) {
+                VertexId u = INVALID_VERTEX;
+                Weight du = INFINITE_WEIGHT;
+                if (!try_pop(queues, pick(), pick(), u, du)) {
+                    if (pending.load(std::memory_order_acquire) == 0) break;
+                    std::this_thread::yield();
+                    continue;
+                }
+                if (du <= dist[u].load(std::memory_order_relaxed)) {   // otherwise stale
+                    for (std::size_t i = offsets[u]; i < offsets[u + 1]; ++i) {
+                        const VertexId v = heads[i];
+                        const Weight cand = du + weights[i];
+                        if (!(cand < dist[v].load(std::memory_order_relaxed))) continue;
+                        while (vertex_lock[v].exchange(true, std::memory_order_acquire)) {}
+                        const bool improved = cand < dist[v].load(std::memory_order_relaxed);
+                        if (improved) {
+                            dist[v].store(cand, std::memory_order_relaxed);
+                            state.pred[v] = u;
+                        }
+                        vertex_lock[v].store(false, std::memory_order_release);
+                        if (improved) push(queues, pick, v, cand, pending);
+                    }
+                }
+                pending.fetch_sub(1, std::memory_order_acq_rel);
+            }
+        };
+
+        std::vector<std::thread> pool;
+        pool.reserve(threads - 1);
+        for (std::size_t tid = 1; tid < threads; ++tid) pool.emplace_back(worker, tid);
+        worker(0);
+        for (auto& th : pool) th.join();
+
+        for (VertexId v = 0; v < n; ++v) state.dist[v] = dist[v].load(std::memory_order_relaxed);
+        state.pred[s] = INVALID_VERTEX;
+    }
+
+private:
+    using Entry = std::pair<Weight, VertexId>;
+    using Later = std::greater<Entry>;   // min-heap order for std::push_heap
+
+    /**
+     * @brief One sequential heap with a try-lock and a lock-free view of its minimum
+     */
+    struct alignas(64) Queue {
+        std::atomic<bool> locked{false};
+        std::atomic<Weight> top{INFINITE_WEIGHT};
+        std::vector<Entry> heap;   // lazy deletion: may hold stale copies
+
+        bool try_lock() {
+            return !locked.load(std::memory_order_relaxed) && !locked.exchange(true, std::memory_order_acquire);
+        }
+        void unlock() {
+            top.store(heap.empty() ? INFINITE_WEIGHT : heap.front().first, std::memory_order_relaxed);
+            locked.store(false, std::memory_order_release);
+        }
+    };
+
+    static std::uint64_t next_random(std::uint64_t& x) {
+        x ^= x << 13;
+        x ^= x >> 7;
+        x ^= x << 17;
+        return x;
+    }
+
+    /**
+     * @brief Pop from the better of queues a and b; false if both look empty or the lock is taken
+     */
+    static bool try_pop(std::vector<Queue>& queues, std::size_t a, std::size_t b, VertexId& v, Weight& d) {
+        const Weight ta = queues[a].top.load(std::memory_order_relaxed);
+        const Weight tb = queues[b].top.load(std::memory_order_relaxed);
+        Queue& q = queues[tb < ta ? b : a];
+        if (std::min(ta, tb) == INFINITE_WEIGHT || !q.try_lock()) return false;
+        const bool found = !q.heap.empty();
+        if (found) {
+            std::pop_heap(q.heap.begin(), q.heap.end(), Later());
+            d = q.heap.back().first;
+            v = q.heap.back().second;
+            q.heap.pop_back();
+        }
+        q.unlock();
+        return found;
+    }
+
+    /**
+     * @brief Insert (v, d) into a random queue; older copies of v go stale
+     */
+    template <class Pick>
+    static void push(std::vector<Queue>& queues, Pick& pick, VertexId v, Weight d, std::atomic<std::size_t>& pending) {
+        while (true) {
+            Queue& q = queues[pick()];
+            if (!q.try_lock()) continue;
+            pending.fetch_add(1, std::memory_order_relaxed);
+            q.heap.emplace_back(d, v);
+            std::push_heap(q.heap.begin(), q.heap.end(), Later());
+            q.unlock();
+            return;
+        }
+    }
+};
+
+} // namespace sssp
+
+#endif // SSSP_MULTIQUEUE_HPP
@@ -0,0 +1,56 @@
+#ifndef SSSP_PARALLEL_HPP
+#define SSSP_PARALLEL_HPP
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <thread>
+#include <vector>
+
+namespace sssp {
+
+/**
+ * @brief Resolve a requested thread count (0 = hardware concurrency)
+ */
+inline std::size_t resolve_threads(std::size_t requested) {
+    if (requested > 0) return requested;
+    std::size_t hw = std::thread::hardware_concurrency();
+    return hw > 0 ? hw : 1;
+}
+
+/**
+ * @brief Run fn(index, thread_id) for every index in [0, count)
+ *
+ * Indices are handed out dynamically in chunks of `grain` from a shared
+ * atomic counter, so uneven per-index costs (e.g. searches of different
+ * sizes) balance across threads. thread_id lies in [0, threads) and can
+ * be used to address per-thread workspaces. Runs inline when a single
+ * thread suffices.
+ */
+template <class Fn>
+void parallel_for(std::size_t count, std::size_t num_threads, Fn&& fn, std::size_t grain = 1) {
+    const std::size_t threads = std::min(resolve_threads(num_threads), std::max<std::size_t>(count, 1));
+    grain = std::max<std::size_t>(grain, 1);
+    if (threads <= 1) {
+        for (std::size_t i = 0; i < count; ++i) fn(i, std::size_t(0));
+        return;
+    }
+    std::atomic<std::size_t> next{0};
+    auto worker = [&](std::size_t tid) {
+        while (true) {
+            const std::size_t begin = next.fetch_add(grain);
+            if (begin >= count) break;
+            const std::size_t end = std::min(begin + grain, count);
+            for (std::size_t i = begin; i < end; ++i) fn(i, tid);
+        }
+    };
+    std::vector<std::thread> pool;
+    pool.reserve(threads - 1);
+    for (std::size_t tid = 1; tid < threads; ++tid) pool.emplace_back(worker, tid);
+    worker(0);
+    for (auto& th : pool) th.join();
+}
+
+} // namespace sssp
+
+#endif // SSSP_PARALLEL_HPP
@@ -4,6 +4,7 @@
 #include <chrono>
 #include <atomic>
 #include <iostream>
+#include <initializer_list>
 
 namespace sssp {
 
@@ -11,6 +12,16 @@ struct ProfCounters {
     std::atomic<long long> basecase_ns{0};
     std::atomic<long long> findpivots_ns{0};
     std::atomic<long long> bmssp_ns{0};
+    std::atomic<long long> bmssp_calls{0};
+    std::atomic<long long> pulls{0};
+    std::atomic<long long> basecase_calls{0};
+    std::atomic<long long> basecase_pops{0};
+    std::atomic<long long> dijkstra_frames{0};
+    std::atomic<long long> pivot_calls{0};
+    std::atomic<long long> pivot_frontier{0};      // sum of |S| over FindPivots calls
+    std::atomic<long long> pivots{0};              // sum of |P|
+    std::atomic<long long> pivot_rounds{0};
+    std::atomic<long long> pivot_early_exits{0};
 };
 
 inline ProfCounters& prof() {
@@ -33,6 +44,25 @@ inline void dump_profile(){
     std::cout << "SSSP profile (ms): basecase=" << prof().basecase_ns.load()/1e6
               << " findpivots=" << prof().findpivots_ns.load()/1e6
               << " bmssp=" << prof().bmssp_ns.load()/1e6 << "\n";
+    std::cout << "SSSP counters: bmssp_calls=" << prof().bmssp_calls.load()
+              << " pulls=" << prof().pulls.load()
+              << " basecase_calls=" << prof().basecase_calls.load()
+              << " basecase_pops=" << prof().basecase_pops.load()
+              << " dijkstra_frames=" << prof().dijkstra_frames.load() << "\n";
+    std::cout << "SSSP pivots: calls=" << prof().pivot_calls.load()
+              << " frontier=" << prof().pivot_frontier.load()
+              << " pivots=" << prof().pivots.load()
+              << " rounds=" << prof().pivot_rounds.load()
+              << " early_exits=" << prof().pivot_early_exits.load() << "\n";
+}
+
+inline void reset_profile(){
+    ProfCounters& pc = prof();
+    for (auto* c : {&pc.basecase_ns, &pc.findpivots_ns, &pc.bmssp_ns, &pc.bmssp_calls, &pc.pulls,
+                    &pc.basecase_calls, &pc.basecase_pops, &pc.dijkstra_frames, &pc.pivot_calls,
+                    &pc.pivot_frontier, &pc.pivots, &pc.pivot_rounds, &pc.pivot_early_exits}) {
+        c->store(0);
+    }
 }
 
 } // namespace sssp
@@ -0,0 +1,446 @@
+#ifndef SSSP_TRANSPORT_HPP
+#define SSSP_TRANSPORT_HPP
+
+#include <algorithm>
+#include <condition_variable>
+#include <cstdint>
+#include <cstring>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+#ifndef _WIN32
+#include <cerrno>
+#include <cstdlib>
+#include <poll.h>
+#include <fcntl.h>
+#include <signal.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#endif
+
+namespace sssp {
+
+using Message = std::vector<char>;
+
+/**
+ * @brief Message layer between the ranks of a distributed computation
+ *
+ * The only primitive is a collective all-to-all: every rank calls
+ * exchange() with one (possibly empty) message per destination and gets
+ * back one message per source. Reductions and gathers are built on it, so
+ * a new transport (MPI, RDMA, ...) only has to implement exchange().
+ */
+class Transport {
+public:
+    virtual ~Transport() = default;
+    [[nodiscard]] virtual std::size_t rank() const = 0;
+    [[nodiscard]] virtual std::size_t size() const = 0;
+
+    /**
+     * @brief Send out[r] to rank r and receive from every rank (collective)
+     *
+     * @return in[r] = the message rank r addressed to this rank
+     */
+    virtual std::vector<Message> exchange(std::vector<Message> out) = 0;
+
+    /**
+     * @brief Minimum of value over all ranks (collective)
+     */
+    std::uint64_t all_reduce_min(std::uint64_t value) {
+        std::uint64_t result = value;
+        for (const auto& m : exchange(std::vector<Message>(size(), encode(value)))) result = std::min(result, decode<std::uint64_t>(m));
+        return result;
+    }
+
+    /**
+     * @brief Sum of value over all ranks (collective)
+     */
+    double all_reduce_sum(double value) {
+        double result = 0.0;
+        for (const auto& m : exchange(std::vector<Message>(size(), encode(value)))) result += decode<double>(m);
+        return result;
+    }
+
+private:
+    template <class T>
+    static Message encode(const T& value) {
+        Message m(sizeof(T));
+        std::memcpy(m.data(), &value, sizeof(T));
+        return m;
+    }
+
+    template <class T>
+    static T decode(const Message& m) {
+        if (m.size() != sizeof(T)) throw std::runtime_error("Malformed reduction message");
+        T value;
+        std::memcpy(&value, m.data(), sizeof(T));
+        return value;
+    }
+};
+
+/**
+ * @brief Shared mailboxes for ranks that are threads of one process
+ */
+class LocalHub {
+public:
+    explicit LocalHub(std::size_t ranks) : ranks_(ranks) {
+        if (ranks == 0) throw std::invalid_argument("LocalHub needs at least one rank");
+        for (auto& slots : slots_) slots.assign(ranks * ranks, Message());
+    }
+
+    [[nodiscard]] std::size_t size() const noexcept { return ranks_; }
+
+    std::vector<Message> exchange(std::size_t me, std::vector<Message> out) {
+        std::unique_lock<std::mutex> lock(mutex_);
+        // Two slot sets alternate by generation: a rank that races ahead into
+        // the next exchange writes the other set, and it cannot get two ahead
+        // because that exchange waits for everyone.
+        const std::uint64_t gen = generation_;
+        auto& slots = slots_[gen % 2];
+        for (std::size_t r = 0; r < ranks_; ++r) slots[r * ranks_ + me] = std::move(out[r]);
+        if (++arrived_ == ranks_) {
+            arrived_ = 0;
+            generation_++;
+            cv_.notify_all();
+        } else {
+            cv_.wait(lock, [&] { return generation_ != gen; });
+        }
+        std::vector<Message> in(ranks_);
+        for (std::size_t r = 0; r < ranks_; ++r) in[r] = std::move(slots[me * ranks_ + r]);
+        return in;
+    }
+
+private:
+    std::size_t ranks_;
+    std::mutex mutex_;
+    std::condition_variable cv_;
+    std::size_t arrived_ = 0;
+    std::uint64_t generation_ = 0;
+    std::vector<Message> slots_[2];   // [to * ranks + from]
+};
+
+/**
+ * @brief In-process transport: one rank per thread, sharing a LocalHub
+ */
+class LocalTransport : public Transport {
+public:
+    LocalTransport(LocalHub& hub, std::size_t rank) : hub_(hub), rank_(rank) {}
+
+    [[nodiscard]] std::size_t rank() const override { return rank_; }
+    [[nodiscard]] std::size_t size() const override { return hub_.size(); }
+    std::vector<Message> exchange(std::vector<Message> out) override {
+        if (out.size() != size()) throw std::invalid_argument("exchange needs one message per rank");
+        return hub_.exchange(rank_, std::move(out));
+    }
+
+private:
+    LocalHub& hub_;
+    std::size_t rank_;
+};
+
+/**
+ * @brief Run body(transport) on `ranks` threads connected by a LocalHub
+ *
+ * Exceptions from any rank are rethrown after all threads have joined; a
+ * rank that throws mid-exchange leaves the others blocked, so bodies should
+ * only throw before their first collective.
+ */
+inline void launch_threads(std::size_t ranks, const std::function<void(Transport&)>& body) {
+    LocalHub hub(ranks);
+    std::vector<std::exception_ptr> errors(ranks);
+    std::vector<std::thread> pool;
+    for (std::size_t r = 0; r < ranks; ++r) {
+        pool.emplace_back([&, r] {
+            try {
+                LocalTransport transport(hub, r);
+                body(transport);
+            } catch (...) {
+                errors[r] = std::current_exception();
+            }
+        });
+    }
+    for (auto& th : pool) th.join();
+    for (auto& e : errors) {
+        if (e) std::rethrow_exception(e);
+    }
+}
+
+#ifndef _WIN32
+
+/**
+ * @brief Transport over Unix domain sockets between processes on one host
+ *
+ * Rank r listens on `<dir>/<r>.sock`, connects to every lower rank and
+ * accepts every higher one, giving a full mesh. exchange() writes
+ * length-prefixed messages and reads the peers' replies in one poll loop,
+ * so large messages cannot deadlock on full socket buffers. A peer that
+ * disappears makes exchange() throw instead of blocking forever.
+ */
+class SocketTransport : public Transport {
+public:
+    /**
+     * @throws std::runtime_error if the mesh cannot be set up within connect_timeout_ms
+     */
+    SocketTransport(const std::string& dir, std::size_t rank, std::size_t size, int connect_timeout_ms = 10000)
+        : rank_(rank), peers_(size, -1) {
+        if (rank >= size) throw std::invalid_argument("SocketTransport rank out of range");
+        const std::string own = socket_path(dir, rank);
+        const int listener = ::socket(AF_UNIX, SOCK_STREAM, 0);
+        if (listener < 0) throw std::runtime_error("Cannot create socket");
+        ::unlink(own.c_str());
+        sockaddr_un addr = make_address(own);
+        if (::bind(listener, reinterpret_cast<sockaddr*>(&addr), sizeof(addr)) != 0 ||
+            ::listen(listener, static_cast<int>(size)) != 0) {
+            ::close(listener);
+            throw std::runtime_error("Cannot listen on " + own);
+        }
+        try {
+            for (std::size_t r = 0; r < rank; ++r) {
+                peers_[r] = connect_to(socket_path(dir, r), connect_timeout_ms);
+                const std::uint64_t me = rank;
+                write_all(peers_[r], &me, sizeof(me));
+            }
+            for (std::size_t accepted = rank + 1; accepted < size; ++accepted) {
+                pollfd wait{listener, POLLIN, 0};
+                if (::poll(&wait, 1, connect_timeout_ms) <= 0) throw std::runtime_error("No peer connected to " + own);
+                const int fd = ::accept(listener, nullptr, nullptr);
+                if (fd < 0) throw std::runtime_error("accept failed on " + own);
+                std::uint64_t peer = 0;
+                read_all(fd, &peer, sizeof(peer));
+                if (peer <= rank || peer >= size || peers_[peer] >= 0) {
+                    ::close(fd);
+                    throw std::runtime_error("Unexpected peer handshake on " + own);
+                }
+                peers_[peer] = fd;
+            }
+        } catch (...) {
+            ::close(listener);
+            ::unlink(own.c_str());
+            close_peers();
+            throw;
+        }
+        ::close(listener);
+        ::unlink(own.c_str());
+        for (int fd : peers_) {
+            if (fd >= 0) ::fcntl(fd, F_SETFL, ::fcntl(fd, F_GETFL) | O_NONBLOCK);
+        }
+    }
+
+    SocketTransport(const SocketTransport&) = delete;
+    SocketTransport& operator=(const SocketTransport&) = delete;
+    ~SocketTransport() override { close_peers(); }
+
+    [[nodiscard]] std::size_t rank() const override { return rank_; }
+    [[nodiscard]] std::size_t size() const override { return peers_.size(); }
+
+    std::vector<Message> exchange(std::vector<Message> out) override {
+        const std::size_t n = size();
+        if (out.size() != n) throw std::invalid_argument("exchange needs one message per rank");
+        std::vector<Message> in(n);
+        in[rank_] = std::move(out[rank_]);
+
+        struct Channel {
+            Message send;            // 8-byte length + payload
+            std::size_t sent = 0;
+            std::uint64_t header = 0;
+            std::size_t header_got = 0;
+            std::size_t got = 0;
+        };
+        std::vector<Channel> ch(n);
+        std::size_t open = 0;
+        for (std::size_t r = 0; r < n; ++r) {
+            if (r == rank_) continue;
+            const std::uint64_t len = out[r].size();
+            ch[r].send.resize(sizeof(len) + out[r].size());
+            std::memcpy(ch[r].send.data(), &len, sizeof(len));
+            if (!out[r].empty()) std::memcpy(ch[r].send.data() + sizeof(len), out[r].data(), out[r].size());
+            open += 2;   // one send and one receive per peer
+        }
+
+        std::vector<pollfd> fds;
+        std::vector<std::size_t> fd_rank;
+        while (open > 0) {
+            fds.clear();
+            fd_rank.clear();
+            for (std::size_t r = 0; r < n; ++r) {
+                if (r == rank_) continue;
+                short events = 0;
+                if (ch[r].sent < ch[r].send.size()) events |= POLLOUT;
+                if (!receive_done(ch[r].header_got, ch[r].got, ch[r].header)) events |= POLLIN;
+                if (events == 0) continue;
+                fds.push_back(pollfd{peers_[r], events, 0});
+                fd_rank.push_back(r);
+            }
+            if (::poll(fds.data(), fds.size(), -1) < 0) {
+                if (errno == EINTR) continue;
+                throw std::runtime_error("poll failed in SocketTransport");
+            }
+            for (std::size_t i = 0; i < fds.size(); ++i) {
+                const std::size_t r = fd_rank[i];
+                Channel& c = ch[r];
+                if (fds[i].revents & (POLLERR | POLLNVAL)) throw std::runtime_error("Peer connection failed");
+                if ((fds[i].revents & POLLOUT) && c.sent < c.send.size()) {
+                    const ssize_t k = ::send(peers_[r], c.send.data() + c.sent, c.send.size() - c.sent, SEND_FLAGS);
+                    if (k < 0 && errno != EAGAIN && errno != EWOULDBLOCK && errno != EINTR) {
+                        throw std::runtime_error("Peer connection lost while sending");
+                    }
+                    if (k > 0 && (c.sent += static_cast<std::size_t>(k)) == c.send.size()) open--;
+                }
+                if ((fds[i].revents & (POLLIN | POLLHUP)) && !receive_done(c.header_got, c.got, c.header)) {
+                    ssize_t k;
+                    if (c.header_got < sizeof(c.header)) {
+                        k = ::recv(peers_[r], reinterpret_cast<char*>(&c.header) + c.header_got,
+                                   sizeof(c.header) - c.header_got, 0);
+                        if (k > 0 && (c.header_got += static_cast<std::size_t>(k)) == sizeof(c.header)) {
+                            in[r].resize(c.header);
+                        }
+                    } else {
+                        k = ::recv(peers_[r], in[r].data() + c.got, in[r].size() - c.got, 0);
+                        if (k > 0) c.got += static_cast<std::size_t>(k);
+                    }
+                    if (k == 0) throw std::runtime_error("Peer closed the connection");
+                    if (k < 0 && errno != EAGAIN && errno != EWOULDBLOCK && errno != EINTR) {
+                        throw std::runtime_error("Peer connection lost while receiving");
+                    }
+                    if (receive_done(c.header_got, c.got, c.header)) open--;
+                }
+            }
+        }
+        return in;
+    }
+
+    static std::string socket_path(const std::string& dir, std::size_t rank) {
+        return dir + "/" + std::to_string(rank) + ".sock";
+    }
+
+private:
+#ifdef MSG_NOSIGNAL
+    static constexpr int SEND_FLAGS = MSG_NOSIGNAL;   // a dead peer is an error, not SIGPIPE
+#else
+    static constexpr int SEND_FLAGS = 0;
+#endif
+
+    std::size_t rank_;
+    std::vector<int> peers_;
+
+    static bool receive_done(std::size_t header_got, std::size_t got, std::uint64_t len) {
+        return header_got == sizeof(std::uint64_t) && got == len;
+    }
+
+    static sockaddr_un make_address(const std::string& path) {
+        sockaddr_un addr{};
+        addr.sun_family = AF_UNIX;
+        if (path.size() >= sizeof(addr.sun_path)) throw std::runtime_error("Socket path too long: " + path);
+        std::memcpy(addr.sun_path, path.c_str(), path.size() + 1);
+        return addr;
+    }
+
+    static int connect_to(const std::string& path, int timeout_ms) {
+        const sockaddr_un addr = make_address(path);
+        for (int waited = 0;; waited += 10) {
+            const int fd = ::socket(AF_UNIX, SOCK_STREAM, 0);
+            if (fd < 0) throw std::runtime_error("Cannot create socket");
+            if (::connect(fd, reinterpret_cast<const sockaddr*>(&addr), sizeof(addr)) == 0) return fd;
+            ::close(fd);
+            if (waited >= timeout_ms) throw std::runtime_error("Cannot connect to " + path);
+            ::usleep(10000);   // peer not listening yet
+        }
+    }
+
+    static void write_all(int fd, const void* data, std::size_t len) {
+        const char* p = static_cast<const char*>(data);
+        while (len > 0) {
+            const ssize_t k = ::send(fd, p, len, SEND_FLAGS);
+            if (k < 0 && errno == EINTR) continue;
+            if (k <= 0) throw std::runtime_error("Socket write failed");
+            p += k;
+            len -= static_cast<std::size_t>(k);
+        }
+    }
+
+    static void read_all(int fd, void* data, std::size_t len) {
+        char* p = static_cast<char*>(data);
+        while (len > 0) {
+            const ssize_t k = ::recv(fd, p, len, 0);
+            if (k < 0 && errno == EINTR) continue;
+            if (k <= 0) throw std::runtime_error("Socket read failed");
+            p += k;
+            len -= static_cast<std::size_t>(k);
+        }
+    }
+
+    void close_peers() noexcept {
+        for (int& fd : peers_) {
+            if (fd >= 0) ::close(fd);
+            fd = -1;
+        }
+    }
+};
+
+/**
+ * @brief Run body(transport) in `procs` local processes joined by SocketTransport
+ *
+ * Rank 0 runs in the calling process; ranks 1..procs-1 are forked children
+ * that exit when body returns (status 1 if it throws). The sockets live in
+ * a fresh directory under $TMPDIR (or /tmp) that is removed afterwards.
+ * Fork before starting threads in the caller: only the forking thread
+ * survives in the children.
+ *
+ * @return true if every rank, including rank 0, finished without throwing
+ */
+inline bool launch_local(std::size_t procs, const std::function<void(Transport&)>& body) {
+    if (procs == 0) throw std::invalid_argument("launch_local needs at least one process");
+    const char* tmp = std::getenv("TMPDIR");
+    std::string pattern = std::string(tmp && *tmp ? tmp : "/tmp") + "/sssp-XXXXXX";
+    if (!::mkdtemp(&pattern[0])) throw std::runtime_error("Cannot create socket directory");
+    const std::string dir = pattern;
+
+    std::vector<pid_t> children;
+    for (std::size_t r = 1; r < procs; ++r) {
+        const pid_t pid = ::fork();
+        if (pid < 0) break;   // fewer ranks: rank 0 fails to connect and reports it
+        if (pid == 0) {
+            int status = 0;
+            try {
+                SocketTransport transport(dir, r, procs);
+                body(transport);
+            } catch (...) {
+                status = 1;
+            }
+            ::_exit(status);
+        }
+        children.push_back(pid);
+    }
+
+    bool ok = children.size() + 1 == procs;
+    if (ok) {
+        try {
+            SocketTransport transport(dir, 0, procs);
+            body(transport);
+        } catch (...) {
+            ok = false;
+        }
+    }
+    for (pid_t pid : children) {
+        if (!ok) ::kill(pid, SIGTERM);   // peers may be blocked on rank 0
+        int status = 0;
+        while (::waitpid(pid, &status, 0) < 0 && errno == EINTR) {}
+        ok = ok && WIFEXITED(status) && WEXITSTATUS(status) == 0;
+    }
+    for (std::size_t r = 0; r < procs; ++r) ::unlink(SocketTransport::socket_path(dir, r).c_str());
+    ::rmdir(dir.c_str());
+    return ok;
+}
+
+#endif // _WIN32
+
+} // namespace sssp
+
+#endif // SSSP_TRANSPORT_HPP
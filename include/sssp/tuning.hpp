@@ -0,0 +1,137 @@
+#ifndef SSSP_TUNING_HPP
+#define SSSP_TUNING_HPP
+
+#include "sssp/bmssp.hpp"
+#include <map>
+#include <string>
+#include <fstream>
+#include <sstream>
+#include <cstdlib>
+#include <stdexcept>
+#include <initializer_list>
+
+namespace sssp {
+
+inline const char* pivot_rule_name(PivotRule rule) {
+    switch (rule) {
+        case PivotRule::Projected: return "projected";
+        case PivotRule::Sampled: return "sampled";
+        case PivotRule::SkipSmall: return "skip";
+        case PivotRule::Exact: break;
+    }
+    return "exact";
+}
+
+// Inverse of pivot_rule_name; false for unknown names
+inline bool parse_pivot_rule(const std::string& name, PivotRule& rule) {
+    for (PivotRule r : {PivotRule::Exact, PivotRule::Projected, PivotRule::Sampled, PivotRule::SkipSmall}) {
+        if (name == pivot_rule_name(r)) {
+            rule = r;
+            return true;
+        }
+    }
+    return false;
+}
+
+/**
+ * @brief Tuned BMSSP parameters per graph family, stored as text
+ *
+ * One line per family, e.g. `road k=2 t=8 l=0 M=16 cutoff=1 adapt=0 pivots=exact`. Keys left
+ * out stay 0, i.e. derived from n; an l below BMSSP::top_level(n, t) is
+ * raised to it when the entry is applied. `#` starts a comment. The file is
+ * written by the sssp_autotune tool. Lookups for unknown families fall
+ * back to the `default` entry, then to fully derived parameters.
+ */
+class TuningTable {
+public:
+    void set(const std::string& family, const BMSSPParams& p) { entries_[family] = p; }
+
+    [[nodiscard]] bool contains(const std::string& family) const { return entries_.count(family) != 0; }
+
+    [[nodiscard]] BMSSPParams lookup(const std::string& family) const {
+        auto it = entries_.find(family);
+        if (it == entries_.end()) it = entries_.find("default");
+        return it == entries_.end() ? BMSSPParams() : it->second;
+    }
+
+    [[nodiscard]] const std::map<std::string, BMSSPParams>& entries() const noexcept { return entries_; }
+
+    void save(const std::string& path) const {
+        std::ofstream out(path);
+        if (!out) throw std::runtime_error("Cannot open tuning file for writing: " + path);
+        out << "# family k t l M cutoff (0 = derived from n), adapt (1 = FrameTuner), pivots (PivotRule)\n";
+        for (const auto& [family, p] : entries_) {
+            out << family << " k=" << p.k << " t=" << p.t << " l=" << p.l << " M=" << p.block_size
+                << " cutoff=" << p.dijkstra_cutoff << " adapt=" << (p.adaptive ? 1 : 0)
+                << " pivots=" << pivot_rule_name(p.pivots) << "\n";
+        }
+        if (!out) throw std::runtime_error("Failed to write tuning file: " + path);
+    }
+
+    static TuningTable load(const std::string& path) {
+        std::ifstream in(path);
+        if (!in) throw std::runtime_error("Cannot open tuning file: " + path);
+        TuningTable table;
+        std::string line;
+        for (std::size_t lineno = 1; std::getline(in, line); ++lineno) {
+            line = line.substr(0, line.find('#'));
+            std::istringstream fields(line);
+            std::string family, kv;
+            if (!(fields >> family)) continue;
+            BMSSPParams p;
+            while (fields >> kv) {
+                const auto eq = kv.find('=');
+                if (eq == std::string::npos || !parse_field(kv.substr(0, eq), kv.substr(eq + 1), p)) {
+                    throw std::runtime_error("Bad tuning entry at " + path + ":" + std::to_string(lineno) + ": " + kv);
+                }
+            }
+            table.set(family, p);
+        }
+        return table;
+    }
+
+private:
+    std::map<std::string, BMSSPParams> entries_;
+
+    static bool parse_field(const std::string& key, const std::string& value, BMSSPParams& p) {
+        if (key == "pivots") return parse_pivot_rule(value, p.pivots);
+        if (value.empty() || value.find_first_not_of("0123456789") != std::string::npos) return false;
+        std::size_t x = 0;
+        try {
+            std::size_t used = 0;
+            x = std::stoull(value, &used);
+            if (used != value.size()) return false;
+        } catch (const std::exception&) {
+            return false;
+        }
+        if (key == "k") p.k = x;
+        else if (key == "t") p.t = x;
+        else if (key == "l") p.l = static_cast<int>(x);
+        else if (key == "M") p.block_size = x;
+        else if (key == "cutoff") p.dijkstra_cutoff = x;
+        else if (key == "adapt" && x <= 1) p.adaptive = x == 1;
+        else return false;
+        return true;
+    }
+};
+
+/**
+ * @brief Parameters solveSSSP uses when none are passed
+ *
+ * The `default` entry of the file named by the SSSP_TUNING_FILE environment
+ * variable, read on first use; all-derived parameters if it is unset.
+ *
+ * @throws std::runtime_error if the variable names an unreadable or malformed file
+ */
+inline const BMSSPParams& default_params() {
+    static const BMSSPParams params = [] {
+        const char* path = std::getenv("SSSP_TUNING_FILE");
+        if (path == nullptr || *path == '\0') return BMSSPParams();
+        return TuningTable::load(path).lookup("default");
+    }();
+    return params;
+}
+
+} // namespace sssp
+
+#endif // SSSP_TUNING_HPP
@@ -15,6 +15,10 @@ using EdgeId = std::size_t;
 // Type for edge weights (non-negative real numbers)
 using Weight = double;
 
+// Traversal direction for direction-aware algorithms. Incoming walks edges
+// backwards, i.e. searches the reverse graph without materialising it.
+enum class EdgeDirection { Outgoing, Incoming };
+
 // Special values
 constexpr VertexId INVALID_VERTEX = std::numeric_limits<VertexId>::max();
 constexpr Weight INFINITE_WEIGHT = std::numeric_limits<Weight>::infinity();
@@ -0,0 +1,220 @@
+#ifndef SSSP_ZERO_WEIGHT_CONTRACTION_HPP
+#define SSSP_ZERO_WEIGHT_CONTRACTION_HPP
+
+#include "sssp/types.hpp"
+#include "sssp/graph.hpp"
+#include "sssp/api.hpp"
+#include <vector>
+#include <utility>
+#include <algorithm>
+
+namespace sssp {
+
+/**
+ * @brief Contracts strongly connected components of the zero-weight subgraph
+ *
+ * All vertices of such a component are at the same distance from any
+ * source, so each component becomes one vertex of a smaller graph. Edges
+ * inside a component are dropped and parallel edges between two components
+ * are merged into the cheapest one. This removes the large tie groups that
+ * zero-weight cycles (e.g. from GraphTransform) create for BlockDataStructure,
+ * FindPivots and the <= tie handling in BaseCase/BMSSP.
+ *
+ * solve() runs the batch solver on the contracted graph and expands the
+ * result: every vertex gets its component's distance, the entry vertex of a
+ * component gets the original edge behind the contracted tree edge as its
+ * predecessor, and the remaining members hang off a zero-weight BFS tree
+ * inside the component. The expanded pred array works with reconstruct_path.
+ */
+class ZeroWeightContraction {
+public:
+    static ZeroWeightContraction build(const Graph& G) {
+        ZeroWeightContraction z;
+        const std::size_t n = G.num_vertices();
+        z.n_ = n;
+
+        // Zero-weight subgraph as CSR
+        z.zero_offsets_.assign(n + 1, 0);
+        for (VertexId u = 0; u < n; ++u) {
+            for (const auto& e : G.get_outgoing_edges(u)) {
+                if (e.weight() == 0.0 && e.destination().id() != u) z.zero_offsets_[u + 1]++;
+            }
+        }
+        for (std::size_t i = 0; i < n; ++i) z.zero_offsets_[i + 1] += z.zero_offsets_[i];
+        z.zero_heads_.resize(z.zero_offsets_[n]);
+        for (VertexId u = 0, pos = 0; u < n; ++u) {
+            for (const auto& e : G.get_outgoing_edges(u)) {
+                if (e.weight() == 0.0 && e.destination().id() != u) z.zero_heads_[pos++] = e.destination().id();
+            }
+        }
+
+        const std::size_t C = z.find_components();
+
+        // Members of each component as CSR
+        z.member_offsets_.assign(C + 1, 0);
+        for (VertexId v = 0; v < n; ++v) z.member_offsets_[z.comp_[v] + 1]++;
+        for (std::size_t c = 0; c < C; ++c) z.member_offsets_[c + 1] += z.member_offsets_[c];
+        z.members_.resize(n);
+        std::vector<std::size_t> fill(z.member_offsets_.begin(), z.member_offsets_.end() - 1);
+        for (VertexId v = 0; v < n; ++v) z.members_[fill[z.comp_[v]]++] = v;
+
+        // Contracted graph: cheapest edge per ordered component pair
+        for (std::size_t c = 0; c < C; ++c) z.contracted_.add_vertex(c);
+        std::vector<std::size_t> slot(C, INVALID_SLOT);
+        std::vector<VertexId> heads;
+        std::vector<std::pair<Weight, std::pair<VertexId, VertexId>>> best;
+        for (std::size_t c = 0; c < C; ++c) {
+            heads.clear();
+            best.clear();
+            for (std::size_t i = z.member_offsets_[c]; i < z.member_offsets_[c + 1]; ++i) {
+                const VertexId u = z.members_[i];
+                for (const auto& e : G.get_outgoing_edges(u)) {
+                    const VertexId v = e.destination().id();
+                    const std::size_t cv = z.comp_[v];
+                    if (cv == c) continue;
+                    if (slot[cv] == INVALID_SLOT) {
+                        slot[cv] = best.size();
+                        heads.push_back(cv);
+                        best.push_back({e.weight(), {u, v}});
+                    } else if (e.weight() < best[slot[cv]].first) {
+                        best[slot[cv]] = {e.weight(), {u, v}};
+                    }
+                }
+            }
+            for (VertexId cv : heads) {
+                const auto& b = best[slot[cv]];
+                z.contracted_.add_edge(c, cv, b.first);
+                z.origin_.push_back(b.second);   // contracted edge ids are assigned in order
+                slot[cv] = INVALID_SLOT;
+            }
+        }
+        return z;
+    }
+
+    /**
+     * @brief Solve from source on the contracted graph and expand to G's vertices
+     */
+    void solve(const Vertex& source, DistState& state) const {
+        state.init(n_);
+        if (source.id() >= n_) return;
+        DistState cstate;
+        solveSSSP(contracted_, Vertex(comp_[source.id()]), cstate);
+        expand(cstate, source, state);
+    }
+
+    /**
+     * @brief Expand a solution on contracted() from component(source)
+     */
+    void expand(const DistState& cstate, const Vertex& source, DistState& state) const {
+        state.init(n_);
+        const std::size_t C = num_components();
+        for (VertexId v = 0; v < n_; ++v) state.set(v, cstate.get(comp_[v]));
+
+        std::vector<VertexId> queue;
+        for (std::size_t c = 0; c < C; ++c) {
+            if (cstate.get(c) == INFINITE_WEIGHT) continue;
+            VertexId entry = source.id();
+            if (c != comp_[source.id()]) {
+                if (!cstate.has_pred(c)) continue;
+                const auto [u, v] = origin_[contracted_edge(cstate.get_pred(c), c)];
+                state.set_pred(v, u);
+                entry = v;
+            }
+            // Zero-weight BFS tree over the component from its entry vertex;
+            // pred doubles as the visited mark
+            queue.assign(1, entry);
+            for (std::size_t head = 0; head < queue.size(); ++head) {
+                const VertexId u = queue[head];
+                for (std::size_t i = zero_offsets_[u]; i < zero_offsets_[u + 1]; ++i) {
+                    const VertexId w = zero_heads_[i];
+                    if (comp_[w] != c || w == entry || state.has_pred(w)) continue;
+                    state.set_pred(w, u);
+                    queue.push_back(w);
+                }
+            }
+        }
+    }
+
+    [[nodiscard]] const Graph& contracted() const noexcept { return contracted_; }
+    [[nodiscard]] std::size_t num_components() const noexcept { return member_offsets_.size() - 1; }
+    [[nodiscard]] VertexId component(VertexId v) const { return comp_[v]; }
+    [[nodiscard]] std::vector<VertexId> members(VertexId c) const {
+        return {members_.begin() + static_cast<std::ptrdiff_t>(member_offsets_[c]),
+                members_.begin() + static_cast<std::ptrdiff_t>(member_offsets_[c + 1])};
+    }
+
+private:
+    static constexpr std::size_t INVALID_SLOT = static_cast<std::size_t>(-1);
+
+    std::size_t n_ = 0;
+    std::vector<std::size_t> zero_offsets_;
+    std::vector<VertexId> zero_heads_;
+    std::vector<VertexId> comp_;                 // vertex -> contracted vertex
+    std::vector<std::size_t> member_offsets_{0};
+    std::vector<VertexId> members_;
+    Graph contracted_;
+    std::vector<std::pair<VertexId, VertexId>> origin_;   // contracted edge id -> original (u, v)
+
+    EdgeId contracted_edge(VertexId cu, VertexId cv) const {
+        for (const auto& e : contracted_.get_outgoing_edges(cu)) {
+            if (e.destination().id() == cv) return e.id();
+        }
+        return INVALID_SLOT;
+    }
+
+    /**
+     * @brief Iterative Tarjan SCC over the zero-weight CSR; fills comp_
+     */
+    std::size_t find_components() {
+        const std::size_t n = n_;
+        constexpr std::size_t UNVISITED = static_cast<std::size_t>(-1);
+        comp_.assign(n, UNVISITED);
+        std::vector<std::size_t> index(n, UNVISITED), low(n, 0), next_edge(n, 0);
+        std::vector<char> on_stack(n, 0);
+        std::vector<VertexId> stack, call;
+        std::size_t counter = 0, components = 0;
+
+        for (VertexId root = 0; root < n; ++root) {
+            if (index[root] != UNVISITED) continue;
+            call.push_back(root);
+            while (!call.empty()) {
+                const VertexId u = call.back();
+                if (index[u] == UNVISITED) {
+                    index[u] = low[u] = counter++;
+                    next_edge[u] = zero_offsets_[u];
+                    stack.push_back(u);
+                    on_stack[u] = 1;
+                }
+                bool descended = false;
+                while (next_edge[u] < zero_offsets_[u + 1]) {
+                    const VertexId w = zero_heads_[next_edge[u]++];
+                    if (index[w] == UNVISITED) {
+                        call.push_back(w);
+                        descended = true;
+                        break;
+                    }
+                    if (on_stack[w]) low[u] = std::min(low[u], index[w]);
+                }
+                if (descended) continue;
+
+                call.pop_back();
+                if (!call.empty()) low[call.back()] = std::min(low[call.back()], low[u]);
+                if (low[u] == index[u]) {
+                    VertexId w;
+                    do {
+                        w = stack.back();
+                        stack.pop_back();
+                        on_stack[w] = 0;
+                        comp_[w] = components;
+                    } while (w != u);
+                    components++;
+                }
+            }
+        }
+        return components;
+    }
+};
+
+} // namespace sssp
+
+#endif // SSSP_ZERO_WEIGHT_CONTRACTION_HPP
@@ -0,0 +1,109 @@
+#include "sssp/alt.hpp"
+#include "sssp/api.hpp"
+#include "sssp/graph.hpp"
+#include "sssp/types.hpp"
+#include "test_graphs.hpp"
+#include <gtest/gtest.h>
+#include <cstdio>
+#include <random>
+
+using namespace sssp;
+
+class ALTTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        // 16x16 bidirected grid with random weights
+        G = test::grid(16, 11);
+    }
+
+    Graph G;
+};
+
+TEST_F(ALTTest, LowerBoundsAreAdmissible) {
+    for (auto strategy : {ALT::LandmarkStrategy::Farthest, ALT::LandmarkStrategy::Avoid}) {
+        ALT alt = ALT::preprocess(G, 4, strategy);
+        EXPECT_EQ(alt.num_landmarks(), 4);
+
+        for (VertexId s : {0, 37, 128}) {
+            DistState state;
+            solveSSSP(G, Vertex(s), state);
+            for (VertexId v = 0; v < G.num_vertices(); ++v) {
+                EXPECT_LE(alt.lower_bound(s, v), state.get(v) + 1e-9);
+            }
+        }
+    }
+}
+
+TEST_F(ALTTest, QueryMatchesBatchSolver) {
+    ALT alt = ALT::preprocess(G, 6);
+    DistState state;
+    solveSSSP(G, Vertex(3), state);
+
+    for (VertexId t : {0, 17, 100, 255}) {
+        auto r = alt.query(G, Vertex(3), Vertex(t));
+        EXPECT_NEAR(r.distance, state.get(t), 1e-9);
+        ASSERT_FALSE(r.path.empty());
+        EXPECT_EQ(r.path.front(), Vertex(3));
+        EXPECT_EQ(r.path.back(), Vertex(t));
+        EXPECT_LE(r.settled, G.num_vertices());
+    }
+}
+
+TEST_F(ALTTest, FloatTablesStayExactOnLargeWeights) {
+    // Distances around 1e7 are not representable as floats: the rounded
+    // tables must still give lower bounds and exact query results
+    Graph H;
+    const int n = 200;
+    for (int i = 0; i < n; ++i) H.add_vertex(i);
+    std::mt19937 rng(4);
+    std::uniform_int_distribution<int> vid(0, n - 1);
+    std::uniform_real_distribution<double> w(1e6, 1e6 + 1.0);
+    for (int i = 0; i < n; ++i) H.add_edge(i, (i + 1) % n, w(rng));
+    for (int i = 0; i < 3 * n; ++i) H.add_edge(vid(rng), vid(rng), w(rng));
+
+    ALT alt = ALT::preprocess(H, 4);
+    for (VertexId s : {0, 99}) {
+        DistState state;
+        solveSSSP(H, Vertex(s), state);
+        for (VertexId t = 0; t < H.num_vertices(); ++t) {
+            EXPECT_LE(alt.lower_bound(s, t), state.get(t)) << t;
+            if (t % 20 == 0) {
+                EXPECT_EQ(alt.query(H, Vertex(s), Vertex(t)).distance, state.get(t)) << t;
+            }
+        }
+    }
+}
+
+TEST_F(ALTTest, Unreachable) {
+    Graph H;
+    for (int i = 0; i < 4; ++i) H.add_vertex(i);
+    H.add_edge(0, 1, 1.0);
+    H.add_edge(2, 3, 1.0);
+    ALT alt = ALT::preprocess(H, 2);
+
+    auto r = alt.query(H, Vertex(0), Vertex(3));
+    EXPECT_EQ(r.distance, INFINITE_WEIGHT);
+    EXPECT_TRUE(r.path.empty());
+}
+
+TEST_F(ALTTest, SaveAndLoadRoundTrip) {
+    ALT alt = ALT::preprocess(G, 3, ALT::LandmarkStrategy::Farthest);
+    const std::string path = ::testing::TempDir() + "sssp_alt_index.bin";
+    alt.save(path);
+
+    ALT loaded = ALT::load(path, G);
+    EXPECT_EQ(loaded.landmarks(), alt.landmarks());
+    for (VertexId v : {5, 77, 200}) {
+        EXPECT_EQ(loaded.lower_bound(v, 0), alt.lower_bound(v, 0));
+    }
+
+    Graph other;
+    other.add_edge(0, 1, 1.0);
+    EXPECT_THROW(ALT::load(path, other), std::runtime_error);
+    std::remove(path.c_str());
+}
+
+int main(int argc, char** argv) {
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
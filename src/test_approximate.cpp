@@ -0,0 +1,93 @@
+#include "sssp/approximate.hpp"
+#include "sssp/api.hpp"
+#include "sssp/graph.hpp"
+#include "sssp/types.hpp"
+#include "test_graphs.hpp"
+#include <gtest/gtest.h>
+#include <random>
+
+using namespace sssp;
+
+class ApproximateTest : public ::testing::Test {
+protected:
+    // Random graph with log-uniform weights in [w_lo, w_hi), a zero_fraction of them 0
+    static Graph log_weight_graph(int n, int m, double w_lo, double w_hi, double zero_fraction, unsigned seed) {
+        std::uniform_real_distribution<double> logw(std::log(w_lo), std::log(w_hi)), coin(0.0, 1.0);
+        return test::random_graph(n, m, seed, [&](std::mt19937& rng) {
+            return coin(rng) < zero_fraction ? 0.0 : std::exp(logw(rng));
+        });
+    }
+
+    // exact <= approx <= (1+eps) exact, and dist is the length of the pred path
+    static void expect_within(const Graph& G, const DistState& approx, VertexId source, double eps,
+                              EdgeDirection dir) {
+        DistState exact;
+        solveSSSP(G, Vertex(source), exact, dir);
+        for (VertexId v = 0; v < G.num_vertices(); ++v) {
+            if (exact.get(v) == INFINITE_WEIGHT) {
+                ASSERT_EQ(approx.get(v), INFINITE_WEIGHT) << v;
+                continue;
+            }
+            ASSERT_GE(approx.get(v), exact.get(v) - 1e-9) << v;
+            ASSERT_LE(approx.get(v), (1.0 + eps) * exact.get(v) + 1e-9) << v;
+            if (v == source) continue;
+            ASSERT_TRUE(approx.has_pred(v)) << v;
+            const VertexId p = approx.get_pred(v);
+            bool found = false;
+            for (const auto& e : G.get_edges(Vertex(p), dir)) {
+                found |= Graph::far_end(e, dir).id() == v &&
+                         std::abs(approx.get(p) + e.weight() - approx.get(v)) <= 1e-9 * (1.0 + approx.get(v));
+            }
+            EXPECT_TRUE(found) << v;
+        }
+    }
+};
+
+TEST_F(ApproximateTest, StretchBoundAcrossEpsilons) {
+    for (double eps : {0.01, 0.1, 0.5}) {
+        for (unsigned seed = 0; seed < 3; ++seed) {
+            Graph G = log_weight_graph(400, 1600, 0.1, 100.0, 0.0, seed);
+            ApproximateSSSP engine(G, eps);
+            DistState state;
+            for (VertexId s : {0u, 17u, 123u}) {
+                engine.run(Vertex(s), state);
+                expect_within(G, state, s, eps, EdgeDirection::Outgoing);
+            }
+        }
+    }
+}
+
+TEST_F(ApproximateTest, FewWeightClasses) {
+    Graph G = log_weight_graph(300, 1500, 1.0, 1000.0, 0.0, 4);
+    // log_{1.1}(1000) ~ 72.5 classes, plus the zero class
+    EXPECT_LE(ApproximateSSSP(G, 0.1).num_weight_classes(), 75u);
+    EXPECT_LE(ApproximateSSSP(G, 1.0).num_weight_classes(), 12u);
+}
+
+TEST_F(ApproximateTest, ZeroWeightsAndReverse) {
+    Graph G = log_weight_graph(300, 1200, 1.0, 50.0, 0.2, 8);
+    DistState state;
+    ApproximateSSSP(G, 0.05).run(Vertex(3), state);
+    expect_within(G, state, 3, 0.05, EdgeDirection::Outgoing);
+
+    ApproximateSSSP(G, 0.05, EdgeDirection::Incoming).run(Vertex(9), state);
+    expect_within(G, state, 9, 0.05, EdgeDirection::Incoming);
+}
+
+TEST_F(ApproximateTest, SolveSSSPWithEpsilon) {
+    Graph G = log_weight_graph(200, 900, 0.5, 20.0, 0.0, 2);
+    DistState approx, exact;
+    solveSSSP(G, Vertex(0), approx, 0.2);
+    expect_within(G, approx, 0, 0.2, EdgeDirection::Outgoing);
+
+    solveSSSP(G, Vertex(0), approx, 0.0);   // exact fallback
+    solveSSSP(G, Vertex(0), exact);
+    EXPECT_EQ(approx.dist, exact.dist);
+
+    EXPECT_THROW(ApproximateSSSP(G, 0.0), std::invalid_argument);
+}
+
+int main(int argc, char** argv) {
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,88 @@
+#include "sssp/apsp.hpp"
+#include "sssp/distance_matrix.hpp"
+#include "sssp/graph.hpp"
+#include "sssp/types.hpp"
+#include "test_graphs.hpp"
+#include <gtest/gtest.h>
+#include <cstdio>
+
+using namespace sssp;
+
+class APSPTest : public ::testing::Test {
+protected:
+    // Every entry matches the double-precision distance table
+    static void expect_matches(const Graph& G, const float* D) {
+        const std::size_t n = G.num_vertices();
+        std::vector<Vertex> all;
+        for (VertexId v = 0; v < n; ++v) all.push_back(Vertex(v));
+        const auto ref = distanceMatrix(G, all, all);
+        for (std::size_t i = 0; i < n; ++i) {
+            for (std::size_t j = 0; j < n; ++j) {
+                const Weight r = ref.at(i, j);
+                if (r == INFINITE_WEIGHT) {
+                    ASSERT_EQ(D[i * n + j], std::numeric_limits<float>::infinity()) << i << " " << j;
+                } else {
+                    ASSERT_NEAR(D[i * n + j], r, 1e-4 * std::max(1.0, r)) << i << " " << j;
+                }
+            }
+        }
+    }
+};
+
+TEST_F(APSPTest, BothMethodsMatchReference) {
+    // 150 vertices: partial tiles at the matrix edge; sparse enough to leave
+    // unreachable pairs
+    for (unsigned seed = 0; seed < 3; ++seed) {
+        Graph G = test::random_graph(150, 220, seed);
+        for (APSPMethod method : {APSPMethod::FloydWarshall, APSPMethod::RepeatedSSSP}) {
+            for (std::size_t threads : {1u, 4u}) {
+                APSPOptions opts;
+                opts.method = method;
+                opts.num_threads = threads;
+                auto D = apsp(G, opts);
+                ASSERT_EQ(D.size(), 150u);
+                expect_matches(G, D.data());
+            }
+        }
+    }
+}
+
+TEST_F(APSPTest, AutoPicksByDensity) {
+    Graph sparse = test::random_graph(1000, 2000, 1);
+    Graph dense = test::random_graph(200, 4000, 2);
+    EXPECT_EQ(choose_apsp_method(sparse), APSPMethod::RepeatedSSSP);
+    EXPECT_EQ(choose_apsp_method(dense), APSPMethod::FloydWarshall);
+
+    std::vector<float> out(200 * 200);
+    EXPECT_EQ(apsp(dense, out.data()), APSPMethod::FloydWarshall);
+    expect_matches(dense, out.data());
+}
+
+TEST_F(APSPTest, CallerAndFileBackedMatrices) {
+    Graph G = test::random_graph(90, 400, 3);
+
+    APSPMatrix wrong(10);
+    EXPECT_THROW(apsp(G, wrong), std::invalid_argument);
+
+    const std::string path = ::testing::TempDir() + "sssp_apsp_matrix.bin";
+    {
+        auto M = APSPMatrix::map_file(path, 90);
+        EXPECT_TRUE(M.is_mapped());
+        apsp(G, M);
+        expect_matches(G, M.data());
+        APSPMatrix moved = std::move(M);
+        EXPECT_EQ(moved.at(5, 5), 0.0f);
+    }
+    std::FILE* f = std::fopen(path.c_str(), "rb");
+    ASSERT_NE(f, nullptr);
+    std::vector<float> back(90 * 90);
+    EXPECT_EQ(std::fread(back.data(), sizeof(float), back.size(), f), back.size());
+    std::fclose(f);
+    std::remove(path.c_str());
+    expect_matches(G, back.data());
+}
+
+int main(int argc, char** argv) {
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,135 @@
+#include "sssp/bfs.hpp"
+#include "sssp/api.hpp"
+#include "sssp/graph.hpp"
+#include "sssp/types.hpp"
+#include "test_graphs.hpp"
+#include <gtest/gtest.h>
+#include <random>
+#include <queue>
+
+using namespace sssp;
+
+class BFSTest : public ::testing::Test {
+protected:
+    // Plain queue BFS hop counts as the reference
+    static std::vector<Weight> reference(const Graph& G, VertexId source, Weight unit, EdgeDirection dir) {
+        std::vector<Weight> dist(G.num_vertices(), INFINITE_WEIGHT);
+        std::queue<VertexId> queue;
+        dist[source] = 0.0;
+        queue.push(source);
+        while (!queue.empty()) {
+            const VertexId u = queue.front();
+            queue.pop();
+            for (const auto& e : G.get_edges(Vertex(u), dir)) {
+                const VertexId v = Graph::far_end(e, dir).id();
+                if (dist[v] != INFINITE_WEIGHT) continue;
+                dist[v] = dist[u] + unit;
+                queue.push(v);
+            }
+        }
+        return dist;
+    }
+
+    // Distances match the reference and every pred is an edge one level up
+    static void expect_matches(const Graph& G, const DistState& state, VertexId source, Weight unit,
+                               EdgeDirection dir) {
+        const auto dist = reference(G, source, unit, dir);
+        ASSERT_EQ(state.dist.size(), dist.size());
+        for (VertexId v = 0; v < G.num_vertices(); ++v) {
+            ASSERT_EQ(state.get(v), dist[v]) << v;
+            if (v == source || dist[v] == INFINITE_WEIGHT) {
+                EXPECT_FALSE(state.has_pred(v)) << v;
+                continue;
+            }
+            ASSERT_TRUE(state.has_pred(v)) << v;
+            const VertexId p = state.get_pred(v);
+            bool found = false;
+            for (const auto& e : G.get_edges(Vertex(p), dir)) found |= Graph::far_end(e, dir).id() == v;
+            EXPECT_TRUE(found) << v;
+            EXPECT_EQ(state.get(p) + unit, state.get(v)) << v;
+        }
+    }
+
+    // Random graph where every edge weighs w
+    static Graph uniform_weight_graph(std::size_t n, std::size_t m, Weight w, unsigned seed) {
+        return test::random_graph(n, m, seed, [w](std::mt19937&) { return w; });
+    }
+};
+
+TEST_F(BFSTest, GraphTracksUniformWeights) {
+    Graph G;
+    G.add_vertex(0);
+    EXPECT_FALSE(G.has_uniform_weights());
+    G.add_edge(0, 1, 2.5);
+    G.add_edge(1, 2, 2.5);
+    EXPECT_TRUE(G.has_uniform_weights());
+    EXPECT_EQ(G.uniform_weight(), 2.5);
+
+    G.set_edge_weight(0, 2.5);
+    EXPECT_TRUE(G.has_uniform_weights());
+    G.set_edge_weight(0, 1.0);
+    EXPECT_FALSE(G.has_uniform_weights());
+
+    G.clear();
+    G.add_edge(0, 1, 1.0);
+    EXPECT_TRUE(G.has_uniform_weights());
+    G.add_edge(1, 0, 3.0);
+    EXPECT_FALSE(G.has_uniform_weights());
+}
+
+TEST_F(BFSTest, MatchesReferenceOnSparseGraphs) {
+    for (unsigned seed = 0; seed < 5; ++seed) {
+        Graph G = uniform_weight_graph(3000, 7000, 1.0, seed);
+        for (std::size_t threads : {1u, 4u}) {
+            BFSOptions opts;
+            opts.num_threads = threads;
+            DistState state;
+            DirectionOptimizingBFS::run(G, Vertex(seed), 1.0, state, EdgeDirection::Outgoing, opts);
+            expect_matches(G, state, seed, 1.0, EdgeDirection::Outgoing);
+        }
+    }
+}
+
+TEST_F(BFSTest, BottomUpOnDenseGraphs) {
+    // Dense graph with a low alpha forces bottom-up levels early
+    Graph G = uniform_weight_graph(2000, 60000, 3.0, 7);
+    for (std::size_t threads : {1u, 4u}) {
+        BFSOptions opts;
+        opts.num_threads = threads;
+        opts.alpha = 1.0;
+        DistState state;
+        DirectionOptimizingBFS::run(G, Vertex(5), 3.0, state, EdgeDirection::Outgoing, opts);
+        expect_matches(G, state, 5, 3.0, EdgeDirection::Outgoing);
+    }
+}
+
+TEST_F(BFSTest, ReverseDirection) {
+    Graph G = uniform_weight_graph(1500, 9000, 1.0, 3);
+    DistState state;
+    DirectionOptimizingBFS::run(G, Vertex(11), 1.0, state, EdgeDirection::Incoming);
+    expect_matches(G, state, 11, 1.0, EdgeDirection::Incoming);
+}
+
+TEST_F(BFSTest, SolveSSSPDispatchesOnUniformWeights) {
+    Graph G = uniform_weight_graph(800, 3000, 2.0, 9);
+    ASSERT_TRUE(G.has_uniform_weights());
+    DistState state;
+    solveSSSP(G, Vertex(0), state);
+    expect_matches(G, state, 0, 2.0, EdgeDirection::Outgoing);
+
+    DistState reverse;
+    solveReverseSSSP(G, Vertex(4), reverse);
+    expect_matches(G, reverse, 4, 2.0, EdgeDirection::Incoming);
+
+    // Breaking uniformity falls back to BMSSP; a cheaper edge must be used
+    G.add_edge(0, 799, 0.5);
+    ASSERT_FALSE(G.has_uniform_weights());
+    solveSSSP(G, Vertex(0), state);
+    EXPECT_EQ(state.get(799), 0.5);
+    EXPECT_EQ(state.get_pred(799), 0u);
+}
+
+int main(int argc, char** argv) {
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,91 @@
+#include "sssp/bidirectional.hpp"
+#include "sssp/base_case.hpp"
+#include "sssp/graph.hpp"
+#include "sssp/types.hpp"
+#include "test_graphs.hpp"
+#include <gtest/gtest.h>
+
+using namespace sssp;
+
+class BidirectionalTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        // Common setup if needed
+    }
+
+    // Weight of a vertex path, or infinity if some hop is not an edge
+    static Weight path_weight(const Graph& G, const std::vector<Vertex>& path) {
+        Weight total = 0.0;
+        for (std::size_t i = 0; i + 1 < path.size(); ++i) {
+            Weight best = INFINITE_WEIGHT;
+            for (const auto& e : G.get_outgoing_edges(path[i])) {
+                if (e.destination() == path[i + 1]) best = std::min(best, e.weight());
+            }
+            total += best;
+        }
+        return total;
+    }
+};
+
+TEST_F(BidirectionalTest, SimplePath) {
+    Graph G;
+    for (int i = 0; i < 5; ++i) G.add_vertex(i);
+    G.add_edge(0, 1, 1.0);
+    G.add_edge(1, 2, 2.0);
+    G.add_edge(2, 3, 3.0);
+    G.add_edge(3, 4, 4.0);
+    G.add_edge(0, 4, 20.0);
+
+    auto r = BidirectionalSearch::run(G, Vertex(0), Vertex(4));
+    EXPECT_EQ(r.distance, 10.0);
+    ASSERT_EQ(r.path.size(), 5);
+    EXPECT_EQ(r.path.front(), Vertex(0));
+    EXPECT_EQ(r.path.back(), Vertex(4));
+}
+
+TEST_F(BidirectionalTest, SourceEqualsTarget) {
+    Graph G;
+    G.add_vertex(0);
+    G.add_vertex(1);
+    G.add_edge(0, 1, 1.0);
+
+    auto r = BidirectionalSearch::run(G, Vertex(0), Vertex(0));
+    EXPECT_EQ(r.distance, 0.0);
+    ASSERT_EQ(r.path.size(), 1);
+    EXPECT_EQ(r.path.front(), Vertex(0));
+}
+
+TEST_F(BidirectionalTest, Unreachable) {
+    Graph G;
+    for (int i = 0; i < 3; ++i) G.add_vertex(i);
+    G.add_edge(1, 0, 1.0);
+    G.add_edge(1, 2, 1.0);
+
+    auto r = BidirectionalSearch::run(G, Vertex(0), Vertex(2));
+    EXPECT_EQ(r.distance, INFINITE_WEIGHT);
+    EXPECT_TRUE(r.path.empty());
+}
+
+TEST_F(BidirectionalTest, MatchesDijkstraOnGrid) {
+    // 20x20 bidirected grid with random weights, a small road-network proxy
+    const Graph G = test::grid(20, 7);
+
+    DistState state;
+    state.init(G.num_vertices());
+    BaseCase::run(G, INFINITE_WEIGHT, Vertex(0), state, G.num_vertices());   // k >= n: unbounded
+
+    for (int t : {1, 57, 210, 399}) {
+        auto r = BidirectionalSearch::run(G, Vertex(0), Vertex(t));
+        EXPECT_NEAR(r.distance, state.get(t), 1e-9);
+        ASSERT_FALSE(r.path.empty());
+        EXPECT_EQ(r.path.front(), Vertex(0));
+        EXPECT_EQ(r.path.back(), Vertex(t));
+        EXPECT_NEAR(path_weight(G, r.path), r.distance, 1e-9);
+        EXPECT_LE(r.settled, G.num_vertices());
+    }
+}
+
+int main(int argc, char** argv) {
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -246,6 +246,28 @@ TEST_F(BinaryHeapTest, ComparisonWithStd) {
     EXPECT_TRUE(std_heap.empty());
 }
 
+TEST_F(BinaryHeapTest, ClearAndReuse) {
+    BinaryHeap heap;
+    heap.insert(Vertex(5), 3.0);
+    heap.insert(Vertex(900), 1.0);
+    heap.insert(Vertex(2), 2.0);
+    heap.extract_min();
+    heap.clear();
+
+    EXPECT_TRUE(heap.empty());
+    EXPECT_FALSE(heap.contains(Vertex(5)));
+    EXPECT_FALSE(heap.contains(Vertex(900)));
+    EXPECT_FALSE(heap.contains(Vertex(2)));
+
+    // Stale positions must not leak into the next round
+    EXPECT_TRUE(heap.insert(Vertex(2), 7.0));
+    EXPECT_TRUE(heap.insert(Vertex(5), 4.0));
+    EXPECT_TRUE(heap.is_valid());
+    EXPECT_EQ(heap.extract_min().first, Vertex(5));
+    EXPECT_EQ(heap.extract_min().first, Vertex(2));
+    EXPECT_TRUE(heap.empty());
+}
+
 int main(int argc, char** argv) {
     ::testing::InitGoogleTest(&argc, argv);
     return RUN_ALL_TESTS();
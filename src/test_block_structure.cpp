@@ -136,7 +136,7 @@ TEST_F(BlockStructureTest, MixedOperations) {
 
     // Pull remaining elements
     auto [pulled2, boundary2] = ds.Pull();
-    EXPECT_EQ(pulled2.size(), 0);  // Observed behavior - no elements returned
+    EXPECT_EQ(pulled2.size(), 2);  // The bound-B block survives the first Pull
 
     EXPECT_TRUE(ds.empty());
 }
@@ -158,6 +158,127 @@ TEST_F(BlockStructureTest, DuplicateHandling) {
     EXPECT_EQ(pulled[0].second, 15.0);  // Should have the minimum distance
 }
 
+TEST_F(BlockStructureTest, PullTakesTiesAtTheBoundary) {
+    BlockDataStructure ds;
+    ds.Initialize(2, 100.0);
+
+    // The second smallest value 5 is shared by three keys in D1 and D0;
+    // a boundary of 5 would leave the frame bounded by it unable to settle them
+    ds.Insert(Vertex(1), 1.0);
+    ds.Insert(Vertex(2), 5.0);
+    ds.Insert(Vertex(3), 5.0);
+    ds.Insert(Vertex(4), 9.0);
+    ds.BatchPrepend({{Vertex(5), 5.0}});
+
+    auto [pulled, boundary] = ds.Pull();
+    ASSERT_EQ(pulled.size(), 4);
+    for (const auto& kv : pulled) EXPECT_LT(kv.second, boundary);
+    EXPECT_EQ(boundary, 9.0);
+
+    auto [rest, last] = ds.Pull();
+    ASSERT_EQ(rest.size(), 1);
+    EXPECT_EQ(rest[0].first.id(), 4);
+    EXPECT_EQ(last, 100.0);
+    EXPECT_TRUE(ds.empty());
+}
+
+TEST_F(BlockStructureTest, InsertsAfterDrainingPullAreKept) {
+    BlockDataStructure ds;
+    ds.Initialize(1, 100.0);
+
+    // Draining every block must leave the D1 block with bound B, which is
+    // where later inserts below B land
+    ds.Insert(Vertex(1), 10.0);
+    ds.Insert(Vertex(2), 30.0);
+    while (!ds.empty()) ds.Pull();
+    EXPECT_EQ(ds.num_d1_blocks(), 1);
+
+    ds.Insert(Vertex(3), 40.0);
+    ds.Insert(Vertex(4), 20.0);
+    EXPECT_EQ(ds.size(), 2);
+    auto [first, b1] = ds.Pull();
+    ASSERT_EQ(first.size(), 1);
+    EXPECT_EQ(first[0].first.id(), 4);
+    EXPECT_EQ(b1, 40.0);
+    auto [second, b2] = ds.Pull();
+    ASSERT_EQ(second.size(), 1);
+    EXPECT_EQ(second[0].first.id(), 3);
+    EXPECT_EQ(b2, 100.0);
+}
+
+TEST_F(BlockStructureTest, SplitsOnTiesKeepOrder) {
+    BlockDataStructure ds;
+    ds.Initialize(1, 100.0);
+
+    // Splitting [6, 7] and then [6, 7'] must not give two blocks bound 7,
+    // or the later 5 lands behind a 7
+    ds.Insert(Vertex(1), 6.0);
+    ds.Insert(Vertex(2), 7.0);
+    ds.Insert(Vertex(3), 7.0);
+    ds.Insert(Vertex(4), 5.0);
+
+    auto [pulled, boundary] = ds.Pull();
+    ASSERT_EQ(pulled.size(), 1);
+    EXPECT_EQ(pulled[0].first.id(), 4);
+    EXPECT_EQ(boundary, 6.0);
+}
+
+TEST_F(BlockStructureTest, SplitNeverSeparatesEqualValues) {
+    BlockDataStructure ds;
+    ds.Initialize(2, 100.0);
+
+    // A block of one repeated value cannot be cut into parts with distinct
+    // bounds, so it stays oversized; a smaller insert still comes first
+    for (VertexId v = 1; v <= 5; ++v) ds.Insert(Vertex(v), 7.0);
+    EXPECT_EQ(ds.num_d1_blocks(), 1);
+    ds.Insert(Vertex(6), 8.0);
+    ds.Insert(Vertex(7), 3.0);
+
+    auto [pulled, boundary] = ds.Pull();
+    ASSERT_EQ(pulled.size(), 6);
+    EXPECT_EQ(pulled[0].first.id(), 7);
+    for (std::size_t i = 1; i < pulled.size(); ++i) EXPECT_EQ(pulled[i].second, 7.0);
+    EXPECT_EQ(boundary, 8.0);
+}
+
+TEST_F(BlockStructureTest, StaleCopiesAreNotPulledAgain) {
+    BlockDataStructure ds;
+    ds.Initialize(2, 100.0);
+
+    // 1 moves from D1 (at 20) to D0 (at 3); the D1 copy is stale
+    ds.Insert(Vertex(1), 20.0);
+    ds.Insert(Vertex(2), 10.0);
+    ds.BatchPrepend({{Vertex(1), 3.0}});
+
+    std::vector<VertexId> ids;
+    while (!ds.empty()) {
+        for (const auto& kv : ds.Pull().first) ids.push_back(kv.first.id());
+    }
+    EXPECT_EQ(ids, (std::vector<VertexId>{1, 2}));
+}
+
+TEST_F(BlockStructureTest, StaleCopiesDoNotSetTheBoundary) {
+    BlockDataStructure ds;
+    ds.Initialize(1, 100.0);
+
+    // Lowering 1 from 50 to 5 leaves its old pair in another D1 block
+    ds.Insert(Vertex(1), 50.0);
+    ds.Insert(Vertex(2), 10.0);
+    ds.Insert(Vertex(1), 5.0);
+
+    auto [first, b1] = ds.Pull();
+    ASSERT_EQ(first.size(), 1);
+    EXPECT_EQ(first[0], std::make_pair(Vertex(1), 5.0));
+    EXPECT_EQ(b1, 10.0);
+
+    // Only the stale 50 is left after 2: the boundary is B, not 50
+    auto [second, b2] = ds.Pull();
+    ASSERT_EQ(second.size(), 1);
+    EXPECT_EQ(second[0].first.id(), 2);
+    EXPECT_EQ(b2, 100.0);
+    EXPECT_TRUE(ds.empty());
+}
+
 TEST_F(BlockStructureTest, Performance) {
     const int n = 1000;
     BlockDataStructure ds;
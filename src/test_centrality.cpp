@@ -0,0 +1,156 @@
+#include "sssp/centrality.hpp"
+#include "sssp/graph.hpp"
+#include "sssp/types.hpp"
+#include "test_graphs.hpp"
+#include <gtest/gtest.h>
+#include <random>
+
+using namespace sssp;
+
+class CentralityTest : public ::testing::Test {
+protected:
+    // Small integer weights in [1, max_weight] produce many ties
+    static Graph small_weight_graph(int n, int m, int max_weight, unsigned seed) {
+        std::uniform_int_distribution<int> w(1, max_weight);
+        return test::random_graph(n, m, seed, [&](std::mt19937& rng) { return (Weight)w(rng); });
+    }
+
+    // Reference: all-pairs distances by Floyd-Warshall, then path counts per
+    // source by a DP over vertices in distance order
+    struct Reference {
+        std::vector<std::vector<double>> d, sigma;
+    };
+
+    static Reference all_pairs(const Graph& G) {
+        const std::size_t n = G.num_vertices();
+        Reference r{std::vector<std::vector<double>>(n, std::vector<double>(n, INFINITE_WEIGHT)),
+                    std::vector<std::vector<double>>(n, std::vector<double>(n, 0.0))};
+        for (std::size_t v = 0; v < n; ++v) r.d[v][v] = 0.0;
+        for (const auto& e : G.edges()) {
+            auto& d = r.d[e.source().id()][e.destination().id()];
+            d = std::min(d, e.weight());
+        }
+        for (std::size_t k = 0; k < n; ++k)
+            for (std::size_t i = 0; i < n; ++i)
+                for (std::size_t j = 0; j < n; ++j)
+                    r.d[i][j] = std::min(r.d[i][j], r.d[i][k] + r.d[k][j]);
+        for (std::size_t s = 0; s < n; ++s) {
+            std::vector<std::size_t> order(n);
+            for (std::size_t v = 0; v < n; ++v) order[v] = v;
+            std::sort(order.begin(), order.end(), [&](auto a, auto b) { return r.d[s][a] < r.d[s][b]; });
+            auto& sig = r.sigma[s];
+            sig[s] = 1.0;
+            for (auto w : order) {
+                if (w == s || r.d[s][w] == INFINITE_WEIGHT) continue;
+                for (const auto& e : G.get_incoming_edges(w)) {
+                    auto v = e.source().id();
+                    if (r.d[s][v] + e.weight() == r.d[s][w]) sig[w] += sig[v];
+                }
+            }
+        }
+        return r;
+    }
+
+    static std::vector<double> brute_betweenness(const Graph& G) {
+        const std::size_t n = G.num_vertices();
+        auto r = all_pairs(G);
+        std::vector<double> bc(n, 0.0);
+        for (std::size_t s = 0; s < n; ++s)
+            for (std::size_t t = 0; t < n; ++t) {
+                if (s == t || r.d[s][t] == INFINITE_WEIGHT) continue;
+                for (std::size_t v = 0; v < n; ++v) {
+                    if (v == s || v == t) continue;
+                    if (r.d[s][v] + r.d[v][t] == r.d[s][t]) bc[v] += r.sigma[s][v] * r.sigma[v][t] / r.sigma[s][t];
+                }
+            }
+        return bc;
+    }
+};
+
+TEST_F(CentralityTest, BetweennessMatchesBruteForce) {
+    for (int max_weight : {1, 3}) {   // 1 = unit weights (BFS path)
+        for (unsigned seed = 0; seed < 4; ++seed) {
+            Graph G = small_weight_graph(40, 140, max_weight, seed);
+            const auto expected = brute_betweenness(G);
+            for (std::size_t threads : {1u, 4u}) {
+                CentralityOptions opts;
+                opts.num_threads = threads;
+                const auto bc = betweennessCentrality(G, opts);
+                ASSERT_EQ(bc.size(), expected.size());
+                for (std::size_t v = 0; v < bc.size(); ++v) {
+                    EXPECT_NEAR(bc[v], expected[v], 1e-6 * std::max(1.0, expected[v])) << v;
+                }
+            }
+        }
+    }
+}
+
+TEST_F(CentralityTest, ClosenessAndHarmonicMatchBruteForce) {
+    for (int max_weight : {1, 5}) {
+        Graph G = small_weight_graph(50, 120, max_weight, 9);   // sparse: some vertices reach few others
+        auto r = all_pairs(G);
+        CentralityOptions opts;
+        opts.num_threads = 3;
+        const auto scores = closenessCentrality(G, opts);
+        EXPECT_EQ(scores.sources, 50u);
+        const double others = 49.0;
+        for (std::size_t v = 0; v < 50; ++v) {
+            double sum = 0.0, inv = 0.0, reached = 0.0;
+            for (std::size_t u = 0; u < 50; ++u) {
+                if (u == v || r.d[v][u] == INFINITE_WEIGHT) continue;
+                sum += r.d[v][u];
+                inv += 1.0 / r.d[v][u];
+                reached += 1.0;
+            }
+            const double closeness = sum > 0.0 ? (reached / others) * (reached / sum) : 0.0;
+            EXPECT_NEAR(scores.closeness[v], closeness, 1e-9) << v;
+            EXPECT_NEAR(scores.harmonic[v], inv / others, 1e-9) << v;
+        }
+    }
+}
+
+TEST_F(CentralityTest, PathGraphValues) {
+    // Bidirected path 0 - 1 - 2 - 3 - 4
+    Graph G;
+    for (int i = 0; i < 4; ++i) { G.add_edge(i, i + 1, 1.0); G.add_edge(i + 1, i, 1.0); }
+    const auto bc = betweennessCentrality(G);
+    EXPECT_EQ(bc, (std::vector<double>{0.0, 6.0, 8.0, 6.0, 0.0}));
+    const auto h = harmonicCentrality(G);
+    EXPECT_NEAR(h[2], (1.0 + 1.0 + 0.5 + 0.5) / 4.0, 1e-12);
+}
+
+TEST_F(CentralityTest, SampledEstimates) {
+    // Two dense clusters joined only through vertex 0
+    Graph G;
+    std::mt19937 rng(3);
+    std::uniform_real_distribution<double> w(1.0, 2.0);
+    const int half = 100;
+    for (int c = 0; c < 2; ++c) {
+        std::uniform_int_distribution<int> vid(1 + c * half, (c + 1) * half);
+        for (int i = 0; i < 800; ++i) G.add_edge(vid(rng), vid(rng), w(rng));
+        for (int i = 0; i < 5; ++i) {
+            const int x = vid(rng);
+            G.add_edge(0, x, 1.0);
+            G.add_edge(x, 0, 1.0);
+        }
+    }
+
+    const auto exact = betweennessCentrality(G);
+    CentralityOptions opts;
+    opts.sample_sources = 50;
+    const auto approx = betweennessCentrality(G, opts);
+    EXPECT_EQ(approx, betweennessCentrality(G, opts));    // deterministic for a seed
+    EXPECT_NEAR(approx[0], exact[0], 0.25 * exact[0]);     // the bridge dominates
+    EXPECT_EQ(std::max_element(approx.begin(), approx.end()) - approx.begin(), 0);
+
+    const auto exact_close = closenessCentrality(G);
+    const auto approx_close = closenessCentrality(G, opts);
+    EXPECT_EQ(approx_close.sources, 50u);
+    EXPECT_NEAR(approx_close.harmonic[0], exact_close.harmonic[0], 0.15 * exact_close.harmonic[0]);
+    EXPECT_NEAR(approx_close.closeness[0], exact_close.closeness[0], 0.15 * exact_close.closeness[0]);
+}
+
+int main(int argc, char** argv) {
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,51 @@
+#ifndef SSSP_TEST_CHECKS_HPP
+#define SSSP_TEST_CHECKS_HPP
+
+// gtest cross-checks against a plain Dijkstra, shared by the test suites
+
+#include "sssp/base_case.hpp"
+#include "sssp/graph.hpp"
+#include "sssp/types.hpp"
+#include <gtest/gtest.h>
+#include <algorithm>
+
+namespace sssp {
+namespace test {
+
+// Distances equal Dijkstra's, every pred edge is tight and pred chains reach the source
+inline void expect_matches_dijkstra(const Graph& G, const DistState& state, VertexId source,
+                                    EdgeDirection dir = EdgeDirection::Outgoing) {
+    const std::size_t n = G.num_vertices();
+    DistState reference;
+    reference.init(n);
+    reference.set(source, 0.0);
+    BaseCase::run(G, INFINITE_WEIGHT, Vertex(source), reference, n, dir);
+    ASSERT_EQ(state.dist.size(), n);
+    for (VertexId v = 0; v < n; ++v) {
+        if (reference.get(v) == INFINITE_WEIGHT) {
+            ASSERT_EQ(state.get(v), INFINITE_WEIGHT) << v;
+            EXPECT_FALSE(state.has_pred(v)) << v;
+            continue;
+        }
+        ASSERT_NEAR(state.get(v), reference.get(v), 1e-9) << v;
+        if (v == source) {
+            EXPECT_FALSE(state.has_pred(v)) << v;
+            continue;
+        }
+        ASSERT_TRUE(state.has_pred(v)) << v;
+        const VertexId p = state.get_pred(v);
+        Weight best = INFINITE_WEIGHT;
+        for (const auto& e : G.get_edges(Vertex(p), dir)) {
+            if (Graph::far_end(e, dir).id() == v) best = std::min(best, e.weight());
+        }
+        EXPECT_NEAR(state.get(p) + best, state.get(v), 1e-9) << v;
+        VertexId hop = v;
+        for (std::size_t steps = 0; steps <= n && hop != source; ++steps) hop = state.get_pred(hop);
+        EXPECT_EQ(hop, source) << v;
+    }
+}
+
+} // namespace test
+} // namespace sssp
+
+#endif // SSSP_TEST_CHECKS_HPP
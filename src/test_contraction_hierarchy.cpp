@@ -0,0 +1,103 @@
+#include "sssp/contraction_hierarchy.hpp"
+#include "sssp/api.hpp"
+#include "sssp/graph.hpp"
+#include "sssp/types.hpp"
+#include "test_graphs.hpp"
+#include <gtest/gtest.h>
+#include <cstdio>
+
+using namespace sssp;
+
+class ContractionHierarchyTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        // 15x15 bidirected grid plus a few random long-range edges
+        G = test::grid(15, 5);
+        test::add_long_edges(G, 20, 15.0, 5);
+    }
+
+    // Checks that path is a chain of original edges with total weight d
+    void expect_valid_path(const std::vector<Vertex>& path, Weight d) {
+        Weight total = 0.0;
+        for (std::size_t i = 0; i + 1 < path.size(); ++i) {
+            Weight best = INFINITE_WEIGHT;
+            for (const auto& e : G.get_outgoing_edges(path[i])) {
+                if (e.destination() == path[i + 1]) best = std::min(best, e.weight());
+            }
+            ASSERT_LT(best, INFINITE_WEIGHT);
+            total += best;
+        }
+        EXPECT_NEAR(total, d, 1e-9);
+    }
+
+    Graph G;
+};
+
+TEST_F(ContractionHierarchyTest, QueriesMatchBatchSolver) {
+    CHBuildOptions opts;
+    opts.num_threads = 4;
+    auto ch = ContractionHierarchy::build(G, opts);
+    EXPECT_EQ(ch.num_vertices(), G.num_vertices());
+
+    for (VertexId s : {0, 112, 224}) {
+        DistState state;
+        solveSSSP(G, Vertex(s), state);
+        for (VertexId t = 0; t < G.num_vertices(); t += 7) {
+            auto r = ch.query(Vertex(s), Vertex(t));
+            ASSERT_NEAR(r.distance, state.get(t), 1e-9) << s << " -> " << t;
+            ASSERT_FALSE(r.path.empty());
+            EXPECT_EQ(r.path.front(), Vertex(s));
+            EXPECT_EQ(r.path.back(), Vertex(t));
+            expect_valid_path(r.path, r.distance);
+        }
+    }
+}
+
+TEST_F(ContractionHierarchyTest, ThreadCountDoesNotChangeDistances) {
+    CHBuildOptions one;
+    one.num_threads = 1;
+    CHBuildOptions many;
+    many.num_threads = 8;
+    auto a = ContractionHierarchy::build(G, one);
+    auto b = ContractionHierarchy::build(G, many);
+    for (VertexId t : {3, 50, 199}) {
+        EXPECT_NEAR(a.query(Vertex(10), Vertex(t)).distance, b.query(Vertex(10), Vertex(t)).distance, 1e-9);
+    }
+}
+
+TEST_F(ContractionHierarchyTest, UnreachableTarget) {
+    Graph H;
+    for (int i = 0; i < 4; ++i) H.add_vertex(i);
+    H.add_edge(0, 1, 1.0);
+    H.add_edge(1, 2, 1.0);
+    H.add_edge(3, 2, 1.0);
+    auto ch = ContractionHierarchy::build(H);
+
+    auto r = ch.query(Vertex(0), Vertex(3));
+    EXPECT_EQ(r.distance, INFINITE_WEIGHT);
+    EXPECT_TRUE(r.path.empty());
+    EXPECT_EQ(ch.query(Vertex(0), Vertex(2)).distance, 2.0);
+}
+
+TEST_F(ContractionHierarchyTest, SaveAndLoadRoundTrip) {
+    auto ch = ContractionHierarchy::build(G);
+    const std::string path = ::testing::TempDir() + "sssp_ch.bin";
+    ch.save(path);
+    auto loaded = ContractionHierarchy::load(path);
+    std::remove(path.c_str());
+
+    EXPECT_EQ(loaded.num_vertices(), ch.num_vertices());
+    EXPECT_EQ(loaded.num_shortcuts(), ch.num_shortcuts());
+    EXPECT_EQ(loaded.ranks(), ch.ranks());
+    for (VertexId t : {1, 100, 220}) {
+        auto a = ch.query(Vertex(7), Vertex(t));
+        auto b = loaded.query(Vertex(7), Vertex(t));
+        EXPECT_EQ(a.distance, b.distance);
+        EXPECT_EQ(a.path, b.path);
+    }
+}
+
+int main(int argc, char** argv) {
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,106 @@
+#include "sssp/crp.hpp"
+#include "sssp/api.hpp"
+#include "sssp/graph.hpp"
+#include "sssp/types.hpp"
+#include "test_graphs.hpp"
+#include <gtest/gtest.h>
+#include <cstdint>
+#include <random>
+
+using namespace sssp;
+
+class CRPTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        // 16x16 bidirected grid plus random one-way edges
+        G = test::grid(16, 31);
+        test::add_long_edges(G, 20, 15.0, 31);
+
+        opts.cell_sizes = {12, 60};
+    }
+
+    // Reference distances on a copy of G carrying the given weight column
+    void expect_matches(const CRPOverlay& crp, const std::vector<Weight>& weights) {
+        Graph H;
+        for (VertexId v = 0; v < G.num_vertices(); ++v) H.add_vertex(v);
+        for (const auto& e : G.edges()) H.add_edge(e.source(), e.destination(), weights[e.id()]);
+        for (VertexId s : {0, 77, 170, 255}) {
+            DistState state;
+            solveSSSP(H, Vertex(s), state);
+            for (VertexId t = 0; t < G.num_vertices(); t += 3) {
+                ASSERT_NEAR(crp.query(G, Vertex(s), Vertex(t)).distance, state.get(t), 1e-9) << s << " -> " << t;
+            }
+        }
+    }
+
+    std::vector<Weight> graph_weights() const {
+        std::vector<Weight> w(G.num_edges());
+        for (const auto& e : G.edges()) w[e.id()] = e.weight();
+        return w;
+    }
+
+    Graph G;
+    CRPOptions opts;
+};
+
+TEST_F(CRPTest, PartitionIsNestedAndBounded) {
+    auto crp = CRPOverlay::preprocess(G, opts);
+    ASSERT_EQ(crp.num_levels(), 2u);
+    EXPECT_LT(crp.num_cells(1), crp.num_cells(0));
+
+    std::vector<std::size_t> size0(crp.num_cells(0), 0), size1(crp.num_cells(1), 0);
+    std::vector<std::size_t> parent(crp.num_cells(0), SIZE_MAX);
+    for (VertexId v = 0; v < G.num_vertices(); ++v) {
+        size0[crp.cell(0, v)]++;
+        size1[crp.cell(1, v)]++;
+        auto& p = parent[crp.cell(0, v)];
+        if (p == SIZE_MAX) p = crp.cell(1, v);
+        EXPECT_EQ(p, crp.cell(1, v));   // level-0 cells never straddle level-1 cells
+    }
+    for (auto s : size0) EXPECT_LE(s, 12u);
+    for (auto s : size1) EXPECT_LE(s, 60u);
+}
+
+TEST_F(CRPTest, QueriesMatchBatchSolver) {
+    auto crp = CRPOverlay::preprocess(G, opts);
+    EXPECT_THROW(crp.query(G, Vertex(0), Vertex(1)), std::runtime_error);
+    crp.customize(G, 4);
+    EXPECT_TRUE(crp.is_customized());
+    expect_matches(crp, graph_weights());
+}
+
+TEST_F(CRPTest, RecustomizeWithNewWeights) {
+    auto crp = CRPOverlay::preprocess(G, opts);
+    crp.customize(G);
+
+    std::mt19937 rng(8);
+    std::uniform_real_distribution<double> factor(0.5, 3.0);
+    auto weights = graph_weights();
+    for (auto& w : weights) w *= factor(rng);
+    crp.customize(G, weights, 3);
+    expect_matches(crp, weights);
+
+    weights.pop_back();
+    EXPECT_THROW(crp.customize(G, weights), std::invalid_argument);
+}
+
+TEST_F(CRPTest, UnreachableTarget) {
+    Graph H;
+    for (int i = 0; i < 6; ++i) H.add_vertex(i);
+    H.add_edge(0, 1, 1.0);
+    H.add_edge(1, 2, 1.0);
+    H.add_edge(2, 3, 1.0);
+    H.add_edge(5, 4, 1.0);
+    CRPOptions small;
+    small.cell_sizes = {2, 4};
+    auto crp = CRPOverlay::preprocess(H, small);
+    crp.customize(H);
+    EXPECT_EQ(crp.query(H, Vertex(0), Vertex(3)).distance, 3.0);
+    EXPECT_EQ(crp.query(H, Vertex(0), Vertex(4)).distance, INFINITE_WEIGHT);
+    EXPECT_EQ(crp.query(H, Vertex(3), Vertex(0)).distance, INFINITE_WEIGHT);
+}
+
+int main(int argc, char** argv) {
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,130 @@
+#include "sssp/dag.hpp"
+#include "sssp/api.hpp"
+#include "sssp/graph.hpp"
+#include "sssp/types.hpp"
+#include <gtest/gtest.h>
+#include <random>
+
+using namespace sssp;
+
+class DAGTest : public ::testing::Test {
+protected:
+    // Layered DAG: every edge goes from layer i to a later layer
+    static Graph layered_dag(int layers, int width, int out_degree, unsigned seed) {
+        Graph G;
+        for (int i = 0; i < layers * width; ++i) G.add_vertex(i);
+        std::mt19937 rng(seed);
+        std::uniform_int_distribution<int> col(0, width - 1), skip(1, 3);
+        std::uniform_real_distribution<double> w(0.5, 10.0);
+        for (int l = 0; l + 1 < layers; ++l) {
+            for (int c = 0; c < width; ++c) {
+                for (int d = 0; d < out_degree; ++d) {
+                    const int to = std::min(layers - 1, l + skip(rng));
+                    G.add_edge(l * width + c, to * width + col(rng), w(rng));
+                }
+            }
+        }
+        return G;
+    }
+
+    // Distances match BMSSP and every pred edge is tight
+    static void expect_matches(const Graph& G, VertexId source, EdgeDirection dir) {
+        DistState dag, ref;
+        DAGShortestPaths::run(G, Vertex(source), dag, dir);
+        ref.init(G.num_vertices());
+        ref.set(source, 0.0);
+        std::vector<Vertex> S = {Vertex(source)};
+        BMSSP::run(G, BMSSP::top_level(G.num_vertices(), G.get_t()), INFINITE_WEIGHT, S, ref, G.get_k(), G.get_t(), dir);
+        for (VertexId v = 0; v < G.num_vertices(); ++v) {
+            if (ref.get(v) == INFINITE_WEIGHT) {
+                ASSERT_EQ(dag.get(v), INFINITE_WEIGHT) << v;
+                continue;
+            }
+            ASSERT_NEAR(dag.get(v), ref.get(v), 1e-9) << v;
+            if (v == source) continue;
+            ASSERT_TRUE(dag.has_pred(v)) << v;
+            const VertexId p = dag.get_pred(v);
+            Weight best = INFINITE_WEIGHT;
+            for (const auto& e : G.get_edges(Vertex(p), dir)) {
+                if (Graph::far_end(e, dir).id() == v) best = std::min(best, e.weight());
+            }
+            EXPECT_NEAR(dag.get(p) + best, dag.get(v), 1e-9) << v;
+        }
+    }
+};
+
+TEST_F(DAGTest, DetectsCyclesAndCachesOrder) {
+    Graph G;
+    G.add_edge(0, 1, 1.0);
+    G.add_edge(1, 2, 1.0);
+    G.add_edge(0, 2, 3.0);
+    ASSERT_TRUE(G.is_acyclic());
+    const auto& order = G.topological_order();
+    ASSERT_EQ(order.size(), 3u);
+    EXPECT_EQ(order, (std::vector<VertexId>{0, 1, 2}));
+    EXPECT_EQ(&G.topological_order(), &order);   // cached
+
+    G.set_edge_weight(0, 5.0);                   // weights do not invalidate
+    EXPECT_EQ(&G.topological_order(), &order);
+
+    G.add_edge(2, 0, 1.0);
+    EXPECT_FALSE(G.is_acyclic());
+    EXPECT_TRUE(G.topological_order().empty());
+    G.remove_edge(3);
+    EXPECT_TRUE(G.is_acyclic());
+
+    G.add_edge(1, 1, 0.0);                       // self-loop
+    EXPECT_FALSE(G.is_acyclic());
+    DistState state;
+    EXPECT_THROW(DAGShortestPaths::run(G, Vertex(0), state), std::invalid_argument);
+}
+
+TEST_F(DAGTest, MatchesBMSSPOnLayeredDAGs) {
+    for (unsigned seed = 0; seed < 4; ++seed) {
+        Graph G = layered_dag(30, 40, 3, seed);
+        ASSERT_TRUE(G.is_acyclic());
+        expect_matches(G, seed, EdgeDirection::Outgoing);
+        expect_matches(G, 40 * 15 + seed, EdgeDirection::Outgoing);   // middle layer
+        expect_matches(G, 40 * 29 + seed, EdgeDirection::Incoming);   // last layer, reverse
+    }
+}
+
+TEST_F(DAGTest, SolveSSSPDispatches) {
+    Graph G = layered_dag(10, 10, 2, 5);
+    DistState state;
+    solveSSSP(G, Vertex(3), state);
+    DistState dag;
+    DAGShortestPaths::run(G, Vertex(3), dag);
+    EXPECT_EQ(state.dist, dag.dist);
+    EXPECT_EQ(state.pred, dag.pred);
+
+    solveReverseSSSP(G, Vertex(95), state);
+    DAGShortestPaths::run(G, Vertex(95), dag, EdgeDirection::Incoming);
+    EXPECT_EQ(state.dist, dag.dist);
+}
+
+TEST_F(DAGTest, ExplicitParamsRunTheRecursion) {
+    Graph G = layered_dag(20, 30, 3, 7);
+    DistState dag;
+    DAGShortestPaths::run(G, Vertex(2), dag);
+
+    // All-derived params still dispatch to the sweep
+    DistState state;
+    solveSSSP(G, Vertex(2), state, BMSSPParams());
+    EXPECT_EQ(state.dist, dag.dist);
+    EXPECT_EQ(state.pred, dag.pred);
+
+    // Overrides go to BMSSP and keep the distances
+    BMSSPParams p;
+    p.k = 2;
+    p.t = 1;
+    p.dijkstra_cutoff = 1;
+    EXPECT_FALSE(p.derived());
+    solveSSSP(G, Vertex(2), state, p);
+    for (VertexId v = 0; v < G.num_vertices(); ++v) EXPECT_EQ(state.get(v), dag.get(v)) << v;
+}
+
+int main(int argc, char** argv) {
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,63 @@
+#include "sssp/distance_matrix.hpp"
+#include "sssp/api.hpp"
+#include "sssp/graph.hpp"
+#include "sssp/types.hpp"
+#include "test_graphs.hpp"
+#include <gtest/gtest.h>
+
+using namespace sssp;
+
+class DistanceMatrixTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        // 20x20 bidirected grid with random weights
+        G = test::grid(20, 17);
+    }
+
+    Graph G;
+};
+
+TEST_F(DistanceMatrixTest, MatchesBatchSolver) {
+    std::vector<Vertex> sources = {Vertex(0), Vertex(57), Vertex(210), Vertex(399), Vertex(57)};
+    std::vector<Vertex> targets = {Vertex(1), Vertex(57), Vertex(300), Vertex(1), Vertex(399), Vertex(20)};
+
+    for (std::size_t threads : {1, 4}) {
+        auto M = distanceMatrix(G, sources, targets, threads);
+        ASSERT_EQ(M.rows, sources.size());
+        ASSERT_EQ(M.cols, targets.size());
+        ASSERT_EQ(M.data.size(), sources.size() * targets.size());
+        for (std::size_t i = 0; i < sources.size(); ++i) {
+            DistState state;
+            solveSSSP(G, sources[i], state);
+            for (std::size_t j = 0; j < targets.size(); ++j) {
+                EXPECT_NEAR(M.at(i, j), state.get(targets[j].id()), 1e-9) << i << ", " << j;
+                EXPECT_EQ(M.row(i)[j], M.at(i, j));
+            }
+        }
+    }
+}
+
+TEST_F(DistanceMatrixTest, UnreachableAndEmpty) {
+    Graph H;
+    for (int i = 0; i < 4; ++i) H.add_vertex(i);
+    H.add_edge(0, 1, 2.0);
+    H.add_edge(1, 2, 3.0);
+
+    auto M = distanceMatrix(H, {Vertex(0), Vertex(3)}, {Vertex(2), Vertex(3), Vertex(0)});
+    EXPECT_EQ(M.at(0, 0), 5.0);
+    EXPECT_EQ(M.at(0, 1), INFINITE_WEIGHT);
+    EXPECT_EQ(M.at(0, 2), 0.0);
+    EXPECT_EQ(M.at(1, 0), INFINITE_WEIGHT);
+    EXPECT_EQ(M.at(1, 1), 0.0);
+
+    auto E = distanceMatrix(H, {}, {Vertex(1)});
+    EXPECT_EQ(E.rows, 0u);
+    EXPECT_TRUE(E.data.empty());
+
+    EXPECT_THROW(distanceMatrix(H, {Vertex(0)}, {Vertex(9)}), std::invalid_argument);
+}
+
+int main(int argc, char** argv) {
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,121 @@
+#include "sssp/distributed.hpp"
+#include "sssp/graph.hpp"
+#include "sssp/types.hpp"
+#include "test_checks.hpp"
+#include "test_graphs.hpp"
+#include <gtest/gtest.h>
+#include <cstdio>
+#include <fstream>
+
+using namespace sssp;
+
+class DistributedTest : public ::testing::Test {
+protected:
+    // Solve on `ranks` threads and return the state gathered on rank 0
+    static DistState solve_threads(const Graph& G, std::size_t ranks, VertexId source,
+                                   const DistributedOptions& opts = DistributedOptions()) {
+        DistState gathered;
+        launch_threads(ranks, [&](Transport& t) {
+            const GraphPartition part = GraphPartition::from_graph(G, t.rank(), t.size());
+            const DistributedResult local = DistributedSSSP::run(part, t, source, opts);
+            DistState state = DistributedSSSP::gather(part, t, local);
+            if (t.rank() == 0) gathered = std::move(state);
+        });
+        return gathered;
+    }
+};
+
+TEST_F(DistributedTest, LocalTransportExchangesAndReduces) {
+    launch_threads(4, [](Transport& t) {
+        std::vector<Message> out(t.size());
+        for (std::size_t r = 0; r < t.size(); ++r) out[r].assign(t.rank() + r, static_cast<char>(t.rank()));
+        for (int round = 0; round < 3; ++round) {
+            const std::vector<Message> in = t.exchange(out);
+            for (std::size_t r = 0; r < t.size(); ++r) {
+                if (in[r] != Message(r + t.rank(), static_cast<char>(r))) throw std::runtime_error("bad message");
+            }
+        }
+        if (t.all_reduce_min(10 + t.rank()) != 10) throw std::runtime_error("bad min");
+        if (t.all_reduce_sum(1.5) != 6.0) throw std::runtime_error("bad sum");
+    });
+}
+
+TEST_F(DistributedTest, MatchesDijkstraForAnyRankCount) {
+    const Graph G = test::random_int_graph(600, 2400, 9, 2);
+    for (std::size_t ranks : {1u, 2u, 3u, 5u}) {
+        test::expect_matches_dijkstra(G, solve_threads(G, ranks, 4), 4);
+    }
+}
+
+TEST_F(DistributedTest, GridWithExplicitDelta) {
+    // Tiny delta: nearly all edges heavy; huge delta: one bucket, Bellman-Ford rounds
+    const Graph G = test::grid(25, 6);
+    for (Weight delta : {0.5, 3.0, 1e9}) {
+        DistributedOptions opts;
+        opts.delta = delta;
+        test::expect_matches_dijkstra(G, solve_threads(G, 4, 312, opts), 312);
+    }
+}
+
+TEST_F(DistributedTest, PartitionFromDimacsFile) {
+    const std::string path = ::testing::TempDir() + "sssp_partition.gr";
+    {
+        std::ofstream out(path);
+        out << "c tiny\np sp 5 6\na 1 2 1\na 2 3 2\na 3 4 1\na 4 5 3\na 5 1 1\na 1 3 4\n";
+    }
+    std::size_t edges = 0;
+    for (std::size_t r = 0; r < 2; ++r) {
+        const GraphPartition p = GraphPartition::load_edge_list(path, r, 2);
+        EXPECT_EQ(p.num_vertices, 5u);
+        EXPECT_EQ(p.offsets.back(), p.heads.size());
+        for (std::size_t i = 0; i < p.num_local(); ++i) {
+            for (std::size_t e = p.offsets[i]; e < p.offsets[i + 1]; ++e) EXPECT_LT(p.heads[e], 5u);
+        }
+        edges += p.heads.size();
+    }
+    EXPECT_EQ(edges, 6u);
+
+    DistState gathered;
+    launch_threads(2, [&](Transport& t) {
+        const GraphPartition part = GraphPartition::load_edge_list(path, t.rank(), t.size());
+        DistState state = DistributedSSSP::gather(part, t, DistributedSSSP::run(part, t, 0));
+        if (t.rank() == 0) gathered = std::move(state);
+    });
+    const Weight expected[] = {0.0, 1.0, 3.0, 4.0, 7.0};
+    for (VertexId v = 0; v < 5; ++v) EXPECT_EQ(gathered.get(v), expected[v]) << v;
+    EXPECT_EQ(gathered.get_pred(2), 1u);
+    std::remove(path.c_str());
+
+    EXPECT_THROW(GraphPartition::load_edge_list(path, 0, 1), std::runtime_error);
+    EXPECT_THROW(GraphPartition::from_graph(test::grid(2, 1), 2, 2), std::invalid_argument);
+}
+
+#ifndef _WIN32
+TEST_F(DistributedTest, SocketProcessesMatchDijkstra) {
+    const Graph G = test::grid(30, 3);
+    for (std::size_t procs : {1u, 3u}) {
+        DistState gathered;
+        const bool ok = launch_local(procs, [&](Transport& t) {
+            const GraphPartition part = GraphPartition::from_graph(G, t.rank(), t.size());
+            DistState state = DistributedSSSP::gather(part, t, DistributedSSSP::run(part, t, 17));
+            if (t.rank() == 0) gathered = std::move(state);
+        });
+        ASSERT_TRUE(ok) << procs;
+        test::expect_matches_dijkstra(G, gathered, 17);
+    }
+}
+
+TEST_F(DistributedTest, SocketLauncherReportsFailedRank) {
+    // Rank 1 dies before the first exchange; the others see the closed socket
+    const bool ok = launch_local(3, [](Transport& t) {
+        if (t.rank() == 1) throw std::runtime_error("rank 1 failed");
+        t.all_reduce_min(t.rank());
+    });
+    EXPECT_FALSE(ok);
+}
+#endif
+
+int main(int argc, char** argv) {
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
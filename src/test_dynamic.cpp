@@ -0,0 +1,179 @@
+#include "sssp/dynamic.hpp"
+#include "sssp/api.hpp"
+#include "sssp/graph.hpp"
+#include "sssp/types.hpp"
+#include <gtest/gtest.h>
+#include <random>
+
+using namespace sssp;
+
+class DynamicTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        const int n = 150;
+        for (int i = 0; i < n; ++i) G.add_vertex(i);
+        std::uniform_int_distribution<int> vid(0, n - 1);
+        for (int i = 0; i < 600; ++i) G.add_edge(vid(rng), vid(rng), w(rng));
+    }
+
+    // dist matches a fresh solve and every pred (successor for Incoming) is tight
+    void expect_consistent(const DistState& state, VertexId root, EdgeDirection dir) {
+        DistState fresh;
+        solveSSSP(G, Vertex(root), fresh, dir);
+        ASSERT_EQ(state.dist.size(), fresh.dist.size());
+        for (VertexId v = 0; v < G.num_vertices(); ++v) {
+            if (fresh.get(v) == INFINITE_WEIGHT) {
+                ASSERT_EQ(state.get(v), INFINITE_WEIGHT) << v;
+                continue;
+            }
+            ASSERT_NEAR(state.get(v), fresh.get(v), 1e-9) << v;
+            if (v == root) continue;
+            ASSERT_TRUE(state.has_pred(v)) << v;
+            const VertexId p = state.get_pred(v);
+            Weight best = INFINITE_WEIGHT;
+            for (const auto& e : G.get_edges(Vertex(p), dir)) {
+                if (Graph::far_end(e, dir).id() == v) best = std::min(best, e.weight());
+            }
+            EXPECT_NEAR(state.get(p) + best, state.get(v), 1e-9) << v;
+        }
+    }
+
+    std::vector<EdgeId> random_changes(int decreases, int inserts) {
+        std::vector<EdgeId> changed;
+        std::uniform_int_distribution<EdgeId> eid(0, G.num_edges() - 1);
+        std::uniform_int_distribution<int> vid(0, (int)G.num_vertices());   // may add a new vertex
+        for (int i = 0; i < decreases; ++i) {
+            EdgeId id = eid(rng);
+            G.set_edge_weight(id, G.edge(id).weight() * 0.3);
+            changed.push_back(id);
+        }
+        for (int i = 0; i < inserts; ++i) {
+            G.add_edge(vid(rng), vid(rng), w(rng) * 0.5);
+            changed.push_back(G.num_edges() - 1);
+        }
+        return changed;
+    }
+
+    Graph G;
+    std::mt19937 rng{12};
+    std::uniform_real_distribution<double> w{0.5, 10.0};
+};
+
+TEST_F(DynamicTest, DecreasesAndInsertions) {
+    DistState state;
+    solveSSSP(G, Vertex(0), state);
+    for (int round = 0; round < 5; ++round) {
+        auto changed = random_changes(6, 3);
+        repairAfterDecrease(G, state, changed);
+        expect_consistent(state, 0, EdgeDirection::Outgoing);
+    }
+}
+
+TEST_F(DynamicTest, ReverseTree) {
+    DistState state;
+    solveReverseSSSP(G, Vertex(9), state);
+    auto changed = random_changes(8, 4);
+    repairAfterDecrease(G, state, changed, EdgeDirection::Incoming);
+    expect_consistent(state, 9, EdgeDirection::Incoming);
+}
+
+TEST_F(DynamicTest, UselessChangeDoesNoWork) {
+    Graph H;
+    H.add_edge(0, 1, 1.0);
+    H.add_edge(1, 2, 1.0);
+    H.add_edge(0, 2, 5.0);
+    H.add_edge(3, 2, 1.0);
+    DistState state;
+    solveSSSP(H, Vertex(0), state);
+
+    H.set_edge_weight(2, 3.0);   // still worse than 0 -> 1 -> 2
+    H.set_edge_weight(3, 0.1);   // tail unreachable
+    auto stats = repairAfterDecrease(H, state, {2, 3});
+    EXPECT_EQ(stats.seeds, 0u);
+    EXPECT_EQ(stats.improved, 0u);
+
+    H.set_edge_weight(2, 0.5);
+    stats = repairAfterDecrease(H, state, {2});
+    EXPECT_EQ(stats.seeds, 1u);
+    EXPECT_EQ(stats.improved, 1u);
+    EXPECT_EQ(state.get(2), 0.5);
+    EXPECT_EQ(state.get_pred(2), 0u);
+}
+
+TEST_F(DynamicTest, ManyTreesInParallel) {
+    std::vector<VertexId> roots = {0, 10, 20, 30, 40, 50, 60, 70};
+    std::vector<DistState> states(roots.size());
+    for (std::size_t i = 0; i < roots.size(); ++i) solveSSSP(G, Vertex(roots[i]), states[i]);
+
+    auto changed = random_changes(10, 5);
+    auto stats = repairAfterDecrease(G, states, changed, EdgeDirection::Outgoing, 4);
+    ASSERT_EQ(stats.size(), roots.size());
+    for (std::size_t i = 0; i < roots.size(); ++i) expect_consistent(states[i], roots[i], EdgeDirection::Outgoing);
+}
+
+// Raises or deletes random edges, returning the edges as they were before
+std::vector<Edge> random_increases(Graph& G, std::mt19937& rng, int increases, int deletions) {
+    std::vector<Edge> changed;
+    for (int i = 0; i < increases + deletions; ++i) {
+        std::uniform_int_distribution<std::size_t> pick(0, G.num_edges() - 1);
+        const Edge old = G.edges()[pick(rng)];
+        changed.push_back(old);
+        if (i < increases) G.set_edge_weight(old.id(), old.weight() * 4.0 + 1.0);
+        else G.remove_edge(old.id());
+    }
+    return changed;
+}
+
+TEST_F(DynamicTest, IncreasesAndDeletions) {
+    DistState state;
+    solveSSSP(G, Vertex(0), state);
+    for (int round = 0; round < 5; ++round) {
+        auto changed = random_increases(G, rng, 6, 4);
+        repairAfterIncrease(G, state, changed);
+        expect_consistent(state, 0, EdgeDirection::Outgoing);
+    }
+}
+
+TEST_F(DynamicTest, TreeEdgeIncreasesAffectSubtree) {
+    // 0 -> 1 -> 2 -> 3 with a detour 0 -> 3 and an unrelated edge 4 -> 2
+    Graph H;
+    H.add_edge(0, 1, 1.0);
+    H.add_edge(1, 2, 1.0);
+    H.add_edge(2, 3, 1.0);
+    H.add_edge(0, 3, 10.0);
+    H.add_edge(4, 2, 1.0);
+    DistState state;
+    solveSSSP(H, Vertex(0), state);
+
+    // Off-tree change: nothing to do
+    Edge old = H.edge(3);
+    H.set_edge_weight(3, 20.0);
+    auto stats = repairAfterIncrease(H, state, {old});
+    EXPECT_EQ(stats.affected, 0u);
+
+    // Tree edge 1 -> 2 removed: {2, 3} reset, 3 re-settled via the detour
+    old = H.edge(1);
+    H.remove_edge(1);
+    stats = repairAfterIncrease(H, state, {old});
+    EXPECT_EQ(stats.affected, 2u);
+    EXPECT_EQ(state.get(2), INFINITE_WEIGHT);
+    EXPECT_FALSE(state.has_pred(2));
+    EXPECT_EQ(state.get(3), 20.0);
+    EXPECT_EQ(state.get_pred(3), 0u);
+    EXPECT_EQ(state.get(1), 1.0);
+}
+
+TEST_F(DynamicTest, IncreasesOnReverseAndManyTrees) {
+    std::vector<VertexId> roots = {3, 33, 63, 93};
+    std::vector<DistState> states(roots.size());
+    for (std::size_t i = 0; i < roots.size(); ++i) solveReverseSSSP(G, Vertex(roots[i]), states[i]);
+
+    auto changed = random_increases(G, rng, 8, 8);
+    repairAfterIncrease(G, states, changed, EdgeDirection::Incoming, 3);
+    for (std::size_t i = 0; i < roots.size(); ++i) expect_consistent(states[i], roots[i], EdgeDirection::Incoming);
+}
+
+int main(int argc, char** argv) {
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -187,6 +187,29 @@ TEST_F(FindPivotsTest, ForestConstruction) {
     EXPECT_TRUE(result.P.count(Vertex(0)) > 0 || result.P.count(Vertex(3)) > 0);
 }
 
+TEST_F(FindPivotsTest, PredecessorsFollowLoweredDistances) {
+    // 0 -> 2 directly costs 5, through 1 it costs 2: the lowered distance of
+    // 2 must come with pred 1, not be left without a tree edge
+    Graph g;
+    g.add_edge(0, 1, 1.0);
+    g.add_edge(1, 2, 1.0);
+    g.add_edge(0, 2, 5.0);
+
+    DistState dstate;
+    dstate.init(g.num_vertices());
+    dstate.set(0, 0.0);
+
+    std::unordered_set<Vertex> S = {Vertex(0)};
+    auto result = FindPivots::execute(g, 10.0, S, 3, dstate);
+
+    ASSERT_EQ(result.W.size(), 3u);
+    EXPECT_EQ(dstate.get(1), 1.0);
+    EXPECT_EQ(dstate.get(2), 2.0);
+    EXPECT_EQ(dstate.get_pred(1), 0u);
+    EXPECT_EQ(dstate.get_pred(2), 1u);
+    EXPECT_FALSE(dstate.has_pred(0));
+}
+
 TEST_F(FindPivotsTest, BoundedExploration) {
     std::cout << "\nTest 5: Bounded Exploration (B parameter)\n";
 
@@ -269,6 +292,93 @@ TEST_F(FindPivotsTest, Performance) {
     EXPECT_LE(result.P.size(), result.W.size());
 }
 
+TEST_F(FindPivotsTest, SkipSmallFrontier) {
+    Graph g;
+    for (int i = 0; i < 8; ++i) g.add_edge(i, i + 1, 1.0);
+    DistState dstate;
+    dstate.init(g.num_vertices());
+    for (int i = 0; i < 5; ++i) dstate.set(i, 0.0);
+
+    std::unordered_set<Vertex> small = {Vertex(0), Vertex(1)};
+    auto skipped = FindPivots::execute(g, 100.0, small, 4, dstate, EdgeDirection::Outgoing, PivotRule::SkipSmall);
+    EXPECT_EQ(skipped.P, small);
+    EXPECT_EQ(skipped.W, small);
+    EXPECT_EQ(skipped.rounds, 0u);
+
+    // |S| > k runs the rounds as usual
+    std::unordered_set<Vertex> large = {Vertex(0), Vertex(1), Vertex(2), Vertex(3), Vertex(4)};
+    auto full = FindPivots::execute(g, 100.0, large, 4, dstate, EdgeDirection::Outgoing, PivotRule::SkipSmall);
+    EXPECT_GT(full.rounds, 0u);
+}
+
+TEST_F(FindPivotsTest, ProjectedStopsOnGrowth) {
+    // Binary tree: the frontier doubles every round
+    Graph g;
+    for (int v = 0; v < 31; ++v) {
+        g.add_edge(v, 2 * v + 1, 1.0);
+        g.add_edge(v, 2 * v + 2, 1.0);
+    }
+    auto run = [&](PivotRule rule) {
+        DistState dstate;
+        dstate.init(g.num_vertices());
+        dstate.set(0, 0.0);
+        return FindPivots::execute(g, 100.0, {Vertex(0)}, 8, dstate, EdgeDirection::Outgoing, rule);
+    };
+    auto exact = run(PivotRule::Exact);
+    auto projected = run(PivotRule::Projected);
+    EXPECT_TRUE(exact.early_exit);
+    EXPECT_EQ(exact.rounds, 3u);       // |W| = 15 > 8 after three rounds
+    EXPECT_TRUE(projected.early_exit);
+    EXPECT_EQ(projected.rounds, 1u);   // 3 + 4 + 8 > 8 projected after one
+    EXPECT_EQ(projected.P, exact.P);
+}
+
+TEST_F(FindPivotsTest, SampledFallsBackOnPoorReduction) {
+    // 12 roots with 3-vertex chains and 2 isolated roots: the exact pivots
+    // keep 12 of 14. After one round the sampled chains are projected to
+    // reach k = 3, so Sampled stops with P = S before the last rounds.
+    Graph g;
+    for (int i = 0; i < 14; ++i) g.add_vertex(i);
+    for (int i = 0; i < 12; ++i) {
+        g.add_edge(i, 14 + 2 * i, 1.0);
+        g.add_edge(14 + 2 * i, 15 + 2 * i, 1.0);
+    }
+    std::unordered_set<Vertex> S;
+    for (int i = 0; i < 14; ++i) S.insert(Vertex(i));
+    auto run = [&](PivotRule rule) {
+        DistState dstate;
+        dstate.init(g.num_vertices());
+        for (int i = 0; i < 14; ++i) dstate.set(i, 0.0);
+        return FindPivots::execute(g, 100.0, S, 3, dstate, EdgeDirection::Outgoing, rule);
+    };
+    auto exact = run(PivotRule::Exact);
+    auto sampled = run(PivotRule::Sampled);
+    EXPECT_FALSE(exact.early_exit);
+    EXPECT_EQ(exact.rounds, 3u);
+    EXPECT_EQ(exact.P.size(), 12u);
+    EXPECT_TRUE(sampled.early_exit);
+    EXPECT_EQ(sampled.rounds, 1u);
+    EXPECT_EQ(sampled.P, S);
+}
+
+TEST_F(FindPivotsTest, SampledKeepsGoodReduction) {
+    // One root owns a 4-vertex chain, 39 roots are isolated: one pivot
+    Graph g;
+    for (int i = 0; i < 43; ++i) g.add_vertex(i);
+    g.add_edge(0, 40, 1.0);
+    g.add_edge(40, 41, 1.0);
+    g.add_edge(41, 42, 1.0);
+    std::unordered_set<Vertex> S;
+    for (int i = 0; i < 40; ++i) S.insert(Vertex(i));
+    DistState dstate;
+    dstate.init(g.num_vertices());
+    for (int i = 0; i < 40; ++i) dstate.set(i, 0.0);
+    auto sampled = FindPivots::execute(g, 100.0, S, 3, dstate, EdgeDirection::Outgoing, PivotRule::Sampled);
+    EXPECT_FALSE(sampled.early_exit);
+    EXPECT_EQ(sampled.P, (std::unordered_set<Vertex>{Vertex(0)}));
+    EXPECT_EQ(dstate.get(42), 3.0);
+}
+
 int main(int argc, char** argv) {
     ::testing::InitGoogleTest(&argc, argv);
     return RUN_ALL_TESTS();
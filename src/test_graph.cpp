@@ -116,6 +116,40 @@ TEST_F(GraphTest, AlgorithmParameters) {
     EXPECT_GE(t, 1);
 }
 
+TEST_F(GraphTest, EdgeWeightUpdate) {
+    Graph g;
+    g.add_edge(0, 1, 3.0);
+    g.add_edge(1, 2, 2.0);
+
+    g.set_edge_weight(1, 0.5);
+    EXPECT_EQ(g.edge(1).weight(), 0.5);
+    EXPECT_EQ(g.get_outgoing_edges(Vertex(1)).front().weight(), 0.5);
+    EXPECT_EQ(g.get_incoming_edges(Vertex(2)).front().weight(), 0.5);
+    EXPECT_EQ(g.edge(0).weight(), 3.0);
+
+    EXPECT_THROW(g.set_edge_weight(5, 1.0), std::invalid_argument);
+    EXPECT_THROW(g.set_edge_weight(0, -1.0), std::invalid_argument);
+}
+
+TEST_F(GraphTest, EdgeRemoval) {
+    Graph g;
+    g.add_edge(0, 1, 1.0);
+    g.add_edge(1, 2, 2.0);
+    g.add_edge(0, 2, 4.0);
+
+    g.remove_edge(1);
+    EXPECT_EQ(g.num_edges(), 2);
+    EXPECT_EQ(g.edge_id_bound(), 3);
+    EXPECT_TRUE(g.get_outgoing_edges(Vertex(1)).empty());
+    EXPECT_TRUE(g.get_incoming_edges(Vertex(2)).size() == 1);
+    EXPECT_EQ(g.edge(2).weight(), 4.0);   // ids are not renumbered
+    EXPECT_THROW((void)g.edge(1), std::invalid_argument);
+    EXPECT_THROW(g.remove_edge(1), std::invalid_argument);
+
+    g.add_edge(2, 0, 1.5);
+    EXPECT_EQ(g.edge(3).source(), Vertex(2));
+}
+
 int main(int argc, char** argv) {
     ::testing::InitGoogleTest(&argc, argv);
     return RUN_ALL_TESTS();
@@ -0,0 +1,70 @@
+#ifndef SSSP_TEST_GRAPHS_HPP
+#define SSSP_TEST_GRAPHS_HPP
+
+// Graph generators shared by the gtest suites and the benchmarks; see
+// test_checks.hpp for the gtest cross-checks
+
+#include "sssp/graph.hpp"
+#include "sssp/types.hpp"
+#include <random>
+
+namespace sssp {
+namespace test {
+
+// n vertices, m random edges (self-loops allowed) with weights drawn by weight(rng)
+template <class WeightFn>
+inline Graph random_graph(std::size_t n, std::size_t m, unsigned seed, WeightFn weight) {
+    Graph G;
+    for (std::size_t i = 0; i < n; ++i) G.add_vertex(i);
+    std::mt19937 rng(seed);
+    std::uniform_int_distribution<VertexId> vid(0, n - 1);
+    for (std::size_t i = 0; i < m; ++i) {
+        const VertexId u = vid(rng), v = vid(rng);
+        G.add_edge(u, v, weight(rng));
+    }
+    return G;
+}
+
+// n vertices, m random edges with real weights in [0.5, 10)
+inline Graph random_graph(std::size_t n, std::size_t m, unsigned seed) {
+    std::uniform_real_distribution<double> w(0.5, 10.0);
+    return random_graph(n, m, seed, [&](std::mt19937& rng) { return w(rng); });
+}
+
+// n vertices, m random edges with integer weights in [0, max_w]: ties and zero edges
+inline Graph random_int_graph(std::size_t n, std::size_t m, int max_w, unsigned seed) {
+    std::uniform_int_distribution<int> w(0, max_w);
+    return random_graph(n, m, seed, [&](std::mt19937& rng) { return (Weight)w(rng); });
+}
+
+// side x side bidirected grid with random weights in [1, 10), road-like diameter
+inline Graph grid(int side, unsigned seed) {
+    Graph G;
+    for (int i = 0; i < side * side; ++i) G.add_vertex(i);
+    std::mt19937 rng(seed);
+    std::uniform_real_distribution<double> w(1.0, 10.0);
+    for (int r = 0; r < side; ++r) {
+        for (int c = 0; c < side; ++c) {
+            const int u = r * side + c;
+            if (c + 1 < side) { G.add_edge(u, u + 1, w(rng)); G.add_edge(u + 1, u, w(rng)); }
+            if (r + 1 < side) { G.add_edge(u, u + side, w(rng)); G.add_edge(u + side, u, w(rng)); }
+        }
+    }
+    return G;
+}
+
+// count one-way shortcuts between random vertices of G, weights in [base + 1, base + 10)
+inline void add_long_edges(Graph& G, int count, Weight base, unsigned seed) {
+    std::mt19937 rng(seed);
+    std::uniform_int_distribution<VertexId> vid(0, G.num_vertices() - 1);
+    std::uniform_real_distribution<double> w(1.0, 10.0);
+    for (int i = 0; i < count; ++i) {
+        const VertexId u = vid(rng), v = vid(rng);
+        G.add_edge(u, v, base + w(rng));
+    }
+}
+
+} // namespace test
+} // namespace sssp
+
+#endif // SSSP_TEST_GRAPHS_HPP
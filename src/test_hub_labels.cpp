@@ -0,0 +1,91 @@
+#include "sssp/hub_labels.hpp"
+#include "sssp/contraction_hierarchy.hpp"
+#include "sssp/api.hpp"
+#include "sssp/graph.hpp"
+#include "sssp/types.hpp"
+#include "test_graphs.hpp"
+#include <gtest/gtest.h>
+#include <cstdio>
+
+using namespace sssp;
+
+class HubLabelsTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        // 14x14 bidirected grid with asymmetric weights plus random one-way edges
+        G = test::grid(14, 23);
+        test::add_long_edges(G, 15, 12.0, 23);
+    }
+
+    void expect_exact(const HubLabels& hl) {
+        for (VertexId s : {0, 41, 97, 195}) {
+            DistState state;
+            solveSSSP(G, Vertex(s), state);
+            for (VertexId t = 0; t < G.num_vertices(); ++t) {
+                ASSERT_NEAR(hl.query(s, t), state.get(t), 1e-9) << s << " -> " << t;
+            }
+        }
+    }
+
+    Graph G;
+};
+
+TEST_F(HubLabelsTest, DegreeOrderMatchesBatchSolver) {
+    HubLabelBuildOptions opts;
+    opts.num_threads = 1;
+    expect_exact(HubLabels::build(G, opts));
+}
+
+TEST_F(HubLabelsTest, ParallelBuildMatchesBatchSolver) {
+    HubLabelBuildOptions opts;
+    opts.num_threads = 4;
+    opts.max_batch = 16;
+    expect_exact(HubLabels::build(G, opts));
+}
+
+TEST_F(HubLabelsTest, HierarchyOrder) {
+    auto ch = ContractionHierarchy::build(G);
+    auto order = HubLabels::order_from_ranks(ch.ranks());
+    auto hl = HubLabels::build(G, order);
+    expect_exact(hl);
+
+    auto report = hl.memory_report();
+    EXPECT_EQ(report.num_vertices, G.num_vertices());
+    EXPECT_GE(report.out_entries, G.num_vertices());  // every vertex is its own hub
+    EXPECT_GE(report.in_entries, G.num_vertices());
+    EXPECT_GT(report.bytes, 0u);
+}
+
+TEST_F(HubLabelsTest, UnreachableAndInvalidOrder) {
+    Graph H;
+    for (int i = 0; i < 4; ++i) H.add_vertex(i);
+    H.add_edge(0, 1, 1.0);
+    H.add_edge(1, 2, 2.0);
+    H.add_edge(3, 2, 1.0);
+    auto hl = HubLabels::build(H);
+    EXPECT_EQ(hl.query(0, 2), 3.0);
+    EXPECT_EQ(hl.query(0, 3), INFINITE_WEIGHT);
+    EXPECT_EQ(hl.query(2, 0), INFINITE_WEIGHT);
+    EXPECT_EQ(hl.query(1, 1), 0.0);
+
+    EXPECT_THROW(HubLabels::build(H, std::vector<VertexId>{0, 1}), std::invalid_argument);
+}
+
+TEST_F(HubLabelsTest, SaveAndLoadRoundTrip) {
+    auto hl = HubLabels::build(G);
+    const std::string path = ::testing::TempDir() + "sssp_hub_labels.bin";
+    hl.save(path);
+    auto loaded = HubLabels::load(path);
+    std::remove(path.c_str());
+
+    EXPECT_EQ(loaded.num_vertices(), hl.num_vertices());
+    EXPECT_EQ(loaded.memory_report().bytes, hl.memory_report().bytes);
+    for (VertexId t : {2, 60, 150}) {
+        EXPECT_EQ(loaded.query(9, t), hl.query(9, t));
+    }
+}
+
+int main(int argc, char** argv) {
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
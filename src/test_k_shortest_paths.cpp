@@ -0,0 +1,132 @@
+#include "sssp/k_shortest_paths.hpp"
+#include "sssp/graph.hpp"
+#include "sssp/types.hpp"
+#include "test_graphs.hpp"
+#include <gtest/gtest.h>
+#include <random>
+#include <set>
+
+using namespace sssp;
+
+class KShortestPathsTest : public ::testing::Test {
+protected:
+    // Costs of all simple s-t paths by exhaustive DFS, sorted
+    static std::vector<Weight> all_simple_paths(const Graph& G, VertexId s, VertexId t) {
+        std::vector<Weight> out;
+        std::vector<char> on_path(G.num_vertices(), 0);
+        dfs(G, s, t, 0.0, on_path, out);
+        std::sort(out.begin(), out.end());
+        return out;
+    }
+
+    static void dfs(const Graph& G, VertexId u, VertexId t, Weight cost, std::vector<char>& on_path,
+                    std::vector<Weight>& out) {
+        if (u == t) {
+            out.push_back(cost);
+            return;
+        }
+        on_path[u] = 1;
+        for (const auto& e : G.get_outgoing_edges(u)) {
+            if (!on_path[e.destination().id()]) dfs(G, e.destination().id(), t, cost + e.weight(), on_path, out);
+        }
+        on_path[u] = 0;
+    }
+
+    // Each path is simple, starts at s, ends at t, its edges chain up and
+    // sum to its distance; no path appears twice
+    static void expect_valid(const Graph& G, const KShortestResult& res, VertexId s, VertexId t) {
+        std::set<std::vector<EdgeId>> distinct;
+        for (std::size_t i = 0; i < res.paths.size(); ++i) {
+            const auto& p = res.paths[i];
+            ASSERT_EQ(p.path.front(), Vertex(s));
+            ASSERT_EQ(p.path.back(), Vertex(t));
+            ASSERT_EQ(p.edges.size() + 1, p.path.size());
+            std::set<Vertex> vertices(p.path.begin(), p.path.end());
+            EXPECT_EQ(vertices.size(), p.path.size()) << "path " << i << " has a loop";
+            Weight sum = 0.0;
+            for (std::size_t j = 0; j < p.edges.size(); ++j) {
+                const Edge& e = G.edge(p.edges[j]);
+                EXPECT_EQ(e.source(), p.path[j]);
+                EXPECT_EQ(e.destination(), p.path[j + 1]);
+                sum += e.weight();
+            }
+            EXPECT_NEAR(sum, p.distance, 1e-9);
+            if (i > 0) {
+                EXPECT_LE(res.paths[i - 1].distance, p.distance + 1e-12);
+            }
+            EXPECT_TRUE(distinct.insert(p.edges).second);
+        }
+    }
+};
+
+TEST_F(KShortestPathsTest, ClassicExample) {
+    // Yen's textbook graph (C=0, D=1, E=2, F=3, G=4, H=5)
+    Graph G;
+    G.add_edge(0, 1, 3.0);
+    G.add_edge(0, 2, 2.0);
+    G.add_edge(1, 3, 4.0);
+    G.add_edge(2, 1, 1.0);
+    G.add_edge(2, 3, 2.0);
+    G.add_edge(2, 4, 3.0);
+    G.add_edge(3, 4, 2.0);
+    G.add_edge(3, 5, 1.0);
+    G.add_edge(4, 5, 2.0);
+
+    auto res = kShortestPaths(G, Vertex(0), Vertex(5), 3);
+    ASSERT_EQ(res.paths.size(), 3u);
+    EXPECT_EQ(res.paths[0].distance, 5.0);
+    EXPECT_EQ(res.paths[0].path, (std::vector<Vertex>{Vertex(0), Vertex(2), Vertex(3), Vertex(5)}));
+    EXPECT_EQ(res.paths[1].distance, 7.0);
+    EXPECT_EQ(res.paths[2].distance, 8.0);
+    expect_valid(G, res, 0, 5);
+}
+
+TEST_F(KShortestPathsTest, MatchesExhaustiveEnumeration) {
+    std::mt19937 rng(4);
+    for (int trial = 0; trial < 30; ++trial) {
+        Graph G;
+        const int n = 9;
+        for (int i = 0; i < n; ++i) G.add_vertex(i);
+        std::uniform_int_distribution<int> vid(0, n - 1);
+        std::uniform_int_distribution<int> w(1, 6);   // integer weights give ties
+        for (int i = 0; i < 26; ++i) G.add_edge(vid(rng), vid(rng), w(rng));
+        const VertexId s = vid(rng), t = vid(rng);
+
+        const auto expected = all_simple_paths(G, s, t);
+        KShortestPaths engine(G);
+        auto res = engine.query(Vertex(s), Vertex(t), 12);
+        ASSERT_EQ(res.paths.size(), std::min<std::size_t>(12, expected.size())) << trial;
+        for (std::size_t i = 0; i < res.paths.size(); ++i) EXPECT_EQ(res.paths[i].distance, expected[i]) << trial;
+        expect_valid(G, res, s, t);
+    }
+}
+
+TEST_F(KShortestPathsTest, GridAlternativesReuseEngine) {
+    // 30 x 30 bidirected grid, road-like
+    const Graph G = test::grid(30, 8);
+    KShortestPaths engine(G);
+    for (VertexId t : {899u, 450u}) {
+        auto res = engine.query(Vertex(0), Vertex(t), 10);
+        ASSERT_EQ(res.paths.size(), 10u);
+        expect_valid(G, res, 0, t);
+        EXPECT_GT(res.pruned_spurs, 0u);
+    }
+}
+
+TEST_F(KShortestPathsTest, DegenerateQueries) {
+    Graph G;
+    G.add_edge(0, 1, 1.0);
+    G.add_vertex(2);
+    EXPECT_TRUE(kShortestPaths(G, Vertex(0), Vertex(2), 5).paths.empty());
+    EXPECT_TRUE(kShortestPaths(G, Vertex(0), Vertex(1), 0).paths.empty());
+    auto self = kShortestPaths(G, Vertex(1), Vertex(1), 3);
+    ASSERT_EQ(self.paths.size(), 1u);
+    EXPECT_EQ(self.paths[0].distance, 0.0);
+    auto one = kShortestPaths(G, Vertex(0), Vertex(1), 3);
+    ASSERT_EQ(one.paths.size(), 1u);
+}
+
+int main(int argc, char** argv) {
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
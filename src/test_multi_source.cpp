@@ -0,0 +1,105 @@
+#include "sssp/api.hpp"
+#include "sssp/distance_matrix.hpp"
+#include "sssp/graph.hpp"
+#include "sssp/types.hpp"
+#include "test_graphs.hpp"
+#include <gtest/gtest.h>
+
+using namespace sssp;
+
+class MultiSourceTest : public ::testing::Test {
+protected:
+    // dist is the minimum over sources of offset + d(source, v), the owner
+    // attains it, and the owner's cell is closed under the pred forest
+    static void expect_voronoi(const Graph& G, const std::vector<Vertex>& sources,
+                               const std::vector<Weight>& offsets, const MultiSourceResult& res) {
+        const std::size_t n = G.num_vertices();
+        std::vector<Vertex> all;
+        for (VertexId v = 0; v < n; ++v) all.push_back(Vertex(v));
+        const auto table = distanceMatrix(G, sources, all);
+        auto through = [&](std::size_t i, VertexId v) {
+            return (offsets.empty() ? 0.0 : offsets[i]) + table.at(i, v);
+        };
+        for (VertexId v = 0; v < n; ++v) {
+            Weight best = INFINITE_WEIGHT;
+            for (std::size_t i = 0; i < sources.size(); ++i) best = std::min(best, through(i, v));
+            if (best == INFINITE_WEIGHT) {
+                EXPECT_EQ(res.state.get(v), INFINITE_WEIGHT) << v;
+                EXPECT_EQ(res.owner[v], INVALID_VERTEX) << v;
+                continue;
+            }
+            ASSERT_NEAR(res.state.get(v), best, 1e-9) << v;
+            ASSERT_LT(res.owner[v], sources.size()) << v;
+            EXPECT_NEAR(through(res.owner[v], v), best, 1e-9) << v;
+            if (res.state.has_pred(v)) {
+                EXPECT_EQ(res.owner[res.state.get_pred(v)], res.owner[v]) << v;
+            }
+        }
+    }
+};
+
+TEST_F(MultiSourceTest, NearestFacility) {
+    for (unsigned seed = 0; seed < 4; ++seed) {
+        Graph G = test::random_graph(600, 2400, seed);
+        std::vector<Vertex> sources;
+        for (VertexId v = seed; v < 600; v += 37) sources.push_back(Vertex(v));
+        expect_voronoi(G, sources, {}, solveMultiSource(G, sources));
+    }
+}
+
+TEST_F(MultiSourceTest, OffsetsAndDuplicates) {
+    Graph G = test::random_graph(400, 1600, 11);
+    std::vector<Vertex> sources = {Vertex(1), Vertex(50), Vertex(50), Vertex(300), Vertex(301)};
+    std::vector<Weight> offsets = {0.0, 7.0, 2.0, 30.0, 1e6};   // 301 is dominated by its neighbours
+    auto res = solveMultiSource(G, sources, offsets);
+    expect_voronoi(G, sources, offsets, res);
+    if (res.owner[50] != INVALID_VERTEX && !res.state.has_pred(50)) {
+        EXPECT_EQ(res.owner[50], 2u);
+    }
+
+    EXPECT_THROW(solveMultiSource(G, sources, {1.0}), std::invalid_argument);
+    EXPECT_THROW(solveMultiSource(G, {Vertex(1000)}), std::invalid_argument);
+}
+
+TEST_F(MultiSourceTest, LineSplitsBetweenTwoDepots) {
+    // 0 - 1 - 2 - 3 - 4 - 5 - 6, depots at both ends
+    Graph G;
+    for (int i = 0; i < 6; ++i) { G.add_edge(i, i + 1, 1.0); G.add_edge(i + 1, i, 1.0); }
+    auto res = solveMultiSource(G, {Vertex(0), Vertex(6)}, {0.0, 1.5});
+    EXPECT_EQ(res.owner, (std::vector<VertexId>{0, 0, 0, 0, 1, 1, 1}));
+    EXPECT_EQ(res.state.get(3), 3.0);
+    EXPECT_EQ(res.state.get(4), 3.5);
+    EXPECT_EQ(res.state.get(5), 2.5);
+
+    // Reverse direction: distance from every vertex to its nearest depot
+    Graph H;
+    H.add_edge(0, 1, 1.0);
+    H.add_edge(1, 2, 1.0);
+    H.add_edge(3, 2, 5.0);
+    auto rev = solveMultiSource(H, {Vertex(1), Vertex(2)}, {}, EdgeDirection::Incoming);
+    EXPECT_EQ(rev.owner, (std::vector<VertexId>{0, 0, 1, 1}));
+    EXPECT_EQ(rev.state.get(3), 5.0);
+}
+
+TEST_F(MultiSourceTest, ZeroWeightCyclesAndTies) {
+    // Integer weights with many zeros: lots of equal-distance paths and
+    // zero-weight cycles, which must not close a cycle in the pred forest
+    const Graph G = test::random_int_graph(300, 1500, 2, 5);
+    std::vector<Vertex> sources = {Vertex(0), Vertex(100), Vertex(200)};
+    expect_voronoi(G, sources, {}, solveMultiSource(G, sources));
+}
+
+TEST_F(MultiSourceTest, LargeGraphRunsTheRecursion) {
+    // Above BMSSP::kDefaultDijkstraCutoff, so the sources seed a recursive frame
+    Graph G = test::random_graph(6000, 24000, 3);
+    std::vector<Vertex> sources;
+    for (VertexId v = 0; v < 6000; v += 701) sources.push_back(Vertex(v));
+    std::vector<Weight> offsets(sources.size());
+    for (std::size_t i = 0; i < offsets.size(); ++i) offsets[i] = 3.0 * i;
+    expect_voronoi(G, sources, offsets, solveMultiSource(G, sources, offsets));
+}
+
+int main(int argc, char** argv) {
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
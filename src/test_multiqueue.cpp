@@ -0,0 +1,53 @@
+#include "sssp/multiqueue.hpp"
+#include "sssp/graph.hpp"
+#include "sssp/types.hpp"
+#include "test_checks.hpp"
+#include "test_graphs.hpp"
+#include <gtest/gtest.h>
+
+using namespace sssp;
+
+class MultiQueueTest : public ::testing::Test {};
+
+TEST_F(MultiQueueTest, MatchesDijkstraOnRandomGraphs) {
+    for (unsigned seed = 0; seed < 4; ++seed) {
+        const Graph G = test::random_int_graph(2000, 8000, 9, seed);
+        for (std::size_t threads : {1u, 2u, 4u}) {
+            MultiQueueOptions opts;
+            opts.num_threads = threads;
+            opts.seed = seed + 1;
+            DistState state;
+            MultiQueueSSSP::run(G, Vertex(seed), state, EdgeDirection::Outgoing, opts);
+            test::expect_matches_dijkstra(G, state, seed, EdgeDirection::Outgoing);
+        }
+    }
+}
+
+TEST_F(MultiQueueTest, MatchesDijkstraOnGrid) {
+    // High diameter: many stale pops while the wavefront crosses the grid
+    const Graph G = test::grid(60, 3);
+    for (std::size_t c : {1u, 4u}) {
+        MultiQueueOptions opts;
+        opts.num_threads = 4;
+        opts.queues_per_thread = c;
+        DistState state;
+        MultiQueueSSSP::run(G, Vertex(0), state, EdgeDirection::Outgoing, opts);
+        test::expect_matches_dijkstra(G, state, 0, EdgeDirection::Outgoing);
+    }
+}
+
+TEST_F(MultiQueueTest, ReverseDirectionAndUnreachable) {
+    Graph G = test::random_int_graph(1500, 3000, 5, 8);
+    G.add_vertex(1500);   // isolated
+    MultiQueueOptions opts;
+    opts.num_threads = 3;
+    DistState state;
+    MultiQueueSSSP::run(G, Vertex(7), state, EdgeDirection::Incoming, opts);
+    test::expect_matches_dijkstra(G, state, 7, EdgeDirection::Incoming);
+    EXPECT_EQ(state.get(1500), INFINITE_WEIGHT);
+}
+
+int main(int argc, char** argv) {
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
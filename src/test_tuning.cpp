@@ -0,0 +1,193 @@
+#include "sssp/api.hpp"
+#include "sssp/tuning.hpp"
+#include "sssp/graph.hpp"
+#include "sssp/types.hpp"
+#include "test_graphs.hpp"
+#include <gtest/gtest.h>
+#include <cstdio>
+#include <fstream>
+#include <string>
+
+using namespace sssp;
+
+class TuningTest : public ::testing::Test {
+protected:
+    static std::string temp_path(const char* name) {
+        return ::testing::TempDir() + name;
+    }
+
+    static void expect_same(const BMSSPParams& a, const BMSSPParams& b) {
+        EXPECT_EQ(a.k, b.k);
+        EXPECT_EQ(a.t, b.t);
+        EXPECT_EQ(a.l, b.l);
+        EXPECT_EQ(a.block_size, b.block_size);
+        EXPECT_EQ(a.dijkstra_cutoff, b.dijkstra_cutoff);
+        EXPECT_EQ(a.adaptive, b.adaptive);
+        EXPECT_EQ(a.pivots, b.pivots);
+    }
+};
+
+TEST_F(TuningTest, SaveLoadRoundTrip) {
+    BMSSPParams road;
+    road.k = 2;
+    road.t = 8;
+    road.l = 3;
+    road.block_size = 16;
+    road.dijkstra_cutoff = 1;
+    road.adaptive = true;
+    road.pivots = PivotRule::Sampled;
+    BMSSPParams social;
+    social.k = 4;
+
+    TuningTable table;
+    table.set("road", road);
+    table.set("social", social);
+    const std::string path = temp_path("sssp_tuning_roundtrip.txt");
+    table.save(path);
+
+    const TuningTable loaded = TuningTable::load(path);
+    EXPECT_EQ(loaded.entries().size(), 2u);
+    expect_same(loaded.lookup("road"), road);
+    expect_same(loaded.lookup("social"), social);
+    std::remove(path.c_str());
+}
+
+TEST_F(TuningTest, LookupFallsBackToDefaultThenDerived) {
+    TuningTable table;
+    expect_same(table.lookup("road"), BMSSPParams());
+
+    BMSSPParams fallback;
+    fallback.t = 4;
+    table.set("default", fallback);
+    EXPECT_FALSE(table.contains("road"));
+    expect_same(table.lookup("road"), fallback);
+}
+
+TEST_F(TuningTest, ParsesCommentsAndPartialEntries) {
+    const std::string path = temp_path("sssp_tuning_partial.txt");
+    {
+        std::ofstream out(path);
+        out << "# tuned by hand\n\n"
+            << "grid t=2   # only t\n"
+            << "  default k=1 cutoff=18446744073709551615\n";
+    }
+    const TuningTable table = TuningTable::load(path);
+    EXPECT_EQ(table.lookup("grid").t, 2u);
+    EXPECT_EQ(table.lookup("grid").k, 0u);
+    EXPECT_EQ(table.lookup("default").k, 1u);
+    EXPECT_EQ(table.lookup("default").dijkstra_cutoff, std::numeric_limits<std::size_t>::max());
+    std::remove(path.c_str());
+}
+
+TEST_F(TuningTest, MalformedEntriesThrow) {
+    const std::string path = temp_path("sssp_tuning_bad.txt");
+    for (const char* line : {"road k=two\n", "road q=3\n", "road k\n", "road t=-1\n", "road adapt=2\n", "road pivots=fast\n"}) {
+        {
+            std::ofstream out(path);
+            out << line;
+        }
+        EXPECT_THROW(TuningTable::load(path), std::runtime_error) << line;
+    }
+    std::remove(path.c_str());
+    EXPECT_THROW(TuningTable::load(temp_path("sssp_tuning_missing.txt")), std::runtime_error);
+}
+
+TEST_F(TuningTest, ResolveDerivesZeroFields) {
+    BMSSPParams p;
+    p.t = 2;
+    p.dijkstra_cutoff = 1;
+    const BMSSPParams r = BMSSP::resolve(p, 1000);
+    EXPECT_EQ(r.k, compute_k(1000));
+    EXPECT_EQ(r.t, 2u);
+    EXPECT_EQ(r.l, BMSSP::top_level(1000, 2));
+    EXPECT_EQ(r.block_size, 0u);   // derived per frame
+    EXPECT_EQ(r.dijkstra_cutoff, 1u);
+
+    p.l = 1;
+    EXPECT_EQ(BMSSP::resolve(p, 1000).l, BMSSP::top_level(1000, 2));
+    p.l = BMSSP::top_level(1000, 2) + 1;
+    EXPECT_EQ(BMSSP::resolve(p, 1000).l, p.l);
+}
+
+// Any explicit parameters keep the solve exact; they only change the work
+TEST_F(TuningTest, OverriddenParametersKeepDistances) {
+    const Graph G = test::random_graph(300, 1200, 11);
+    DistState ref;
+    BMSSPParams dijkstra;
+    dijkstra.dijkstra_cutoff = std::numeric_limits<std::size_t>::max();
+    solveSSSP(G, Vertex(0), ref, dijkstra);
+
+    auto expect_exact = [&](const BMSSPParams& p) {
+        DistState state;
+        solveSSSP(G, Vertex(0), state, p);
+        for (VertexId v = 0; v < G.num_vertices(); ++v) {
+            if (ref.get(v) == INFINITE_WEIGHT) {
+                EXPECT_EQ(state.get(v), INFINITE_WEIGHT) << v;
+            } else {
+                EXPECT_NEAR(state.get(v), ref.get(v), 1e-9)
+                    << "k=" << p.k << " t=" << p.t << " l=" << p.l << " M=" << p.block_size
+                    << " adaptive=" << p.adaptive;
+            }
+        }
+    };
+    for (std::size_t k : {1, 2, 5}) {
+        for (std::size_t t : {1, 3}) {
+            for (std::size_t M : {0, 1, 7}) {
+                BMSSPParams p;
+                p.k = k;
+                p.t = t;
+                p.block_size = M;
+                p.dijkstra_cutoff = 1;
+                expect_exact(p);
+                p.adaptive = true;
+                expect_exact(p);
+            }
+        }
+    }
+    // l below top_level(n, t) would cap the top frame under n vertices
+    for (std::size_t t : {1, 2}) {
+        const int top = BMSSP::top_level(G.num_vertices(), t);
+        for (int l : {1, 2, top - 1, top + 2}) {
+            BMSSPParams p;
+            p.k = 1;
+            p.t = t;
+            p.l = l;
+            p.dijkstra_cutoff = 1;
+            expect_exact(p);
+        }
+    }
+    for (PivotRule rule : {PivotRule::Projected, PivotRule::Sampled, PivotRule::SkipSmall}) {
+        BMSSPParams p;
+        p.k = 4;
+        p.t = 2;
+        p.dijkstra_cutoff = 1;
+        p.pivots = rule;
+        expect_exact(p);
+    }
+}
+
+TEST_F(TuningTest, PivotRulesRunInDefaultSolves) {
+    // Above the default cutoff the top frame recurses, so FindPivots runs
+    // with the derived k under every rule
+    const int n = (int)BMSSP::kDefaultDijkstraCutoff + 1000;
+    const Graph G = test::random_graph(n, 4 * n, 17);
+    DistState ref;
+    ref.init(n);
+    ref.set(0, 0.0);
+    BaseCase::run(G, INFINITE_WEIGHT, Vertex(0), ref, n);
+    for (PivotRule rule : {PivotRule::Exact, PivotRule::Projected, PivotRule::Sampled, PivotRule::SkipSmall}) {
+        BMSSPParams p;
+        p.pivots = rule;
+        p.adaptive = true;
+        FrameTuner tuner;
+        DistState state;
+        state.init(n);
+        state.set(0, 0.0);
+        BMSSP::run(G, p, INFINITE_WEIGHT, {Vertex(0)}, state, tuner);
+        ASSERT_GT(tuner.levels().size(), 1u) << pivot_rule_name(rule);
+        EXPECT_GT(tuner.levels().back().frames, 0u) << pivot_rule_name(rule);
+        for (VertexId v = 0; v < (VertexId)n; ++v) {
+            ASSERT_EQ(state.get(v), ref.get(v)) << pivot_rule_name(rule) << " v=" << v;
+        }
+    }
+}
@@ -0,0 +1,112 @@
+#include "sssp/zero_weight_contraction.hpp"
+#include "sssp/api.hpp"
+#include "sssp/path.hpp"
+#include "sssp/graph.hpp"
+#include "sssp/types.hpp"
+#include <gtest/gtest.h>
+#include <random>
+
+using namespace sssp;
+
+class ZeroWeightContractionTest : public ::testing::Test {
+protected:
+    // Distances match a direct solve and every pred edge is tight
+    void expect_matches(const Graph& G, const ZeroWeightContraction& z, VertexId source) {
+        DistState direct, expanded;
+        solveSSSP(G, Vertex(source), direct);
+        z.solve(Vertex(source), expanded);
+        for (VertexId v = 0; v < G.num_vertices(); ++v) {
+            ASSERT_EQ(expanded.get(v) == INFINITE_WEIGHT, direct.get(v) == INFINITE_WEIGHT) << v;
+            if (direct.get(v) == INFINITE_WEIGHT) continue;
+            ASSERT_NEAR(expanded.get(v), direct.get(v), 1e-9) << v;
+            if (v == source) {
+                EXPECT_FALSE(expanded.has_pred(v));
+                continue;
+            }
+            ASSERT_TRUE(expanded.has_pred(v)) << v;
+            const VertexId p = expanded.get_pred(v);
+            Weight best = INFINITE_WEIGHT;
+            for (const auto& e : G.get_outgoing_edges(Vertex(p))) {
+                if (e.destination().id() == v) best = std::min(best, e.weight());
+            }
+            EXPECT_NEAR(expanded.get(p) + best, expanded.get(v), 1e-9) << v;
+
+            auto path = reconstruct_path(Vertex(v), expanded);
+            ASSERT_FALSE(path.empty());
+            EXPECT_EQ(path.front(), Vertex(source));
+        }
+    }
+};
+
+TEST_F(ZeroWeightContractionTest, ContractsCyclesAndChains) {
+    // {1, 2, 3} is a zero cycle, 3 -> 4 is zero but not on a cycle
+    Graph G;
+    for (int i = 0; i < 6; ++i) G.add_vertex(i);
+    G.add_edge(0, 1, 2.0);
+    G.add_edge(1, 2, 0.0);
+    G.add_edge(2, 3, 0.0);
+    G.add_edge(3, 1, 0.0);
+    G.add_edge(3, 4, 0.0);
+    G.add_edge(2, 5, 1.0);
+    G.add_edge(0, 5, 7.0);
+    G.add_edge(1, 5, 4.0);
+
+    auto z = ZeroWeightContraction::build(G);
+    EXPECT_EQ(z.num_components(), 4u);
+    EXPECT_EQ(z.component(1), z.component(2));
+    EXPECT_EQ(z.component(2), z.component(3));
+    EXPECT_NE(z.component(3), z.component(4));
+    EXPECT_EQ(z.members(z.component(1)).size(), 3u);
+    // 1 -> 5 and 2 -> 5 merge into one edge of weight 1
+    EXPECT_EQ(z.contracted().out_degree(Vertex(z.component(1))), 2u);
+
+    expect_matches(G, z, 0);
+    expect_matches(G, z, 2);
+
+    DistState state;
+    z.solve(Vertex(0), state);
+    EXPECT_EQ(state.get(5), 3.0);
+    EXPECT_EQ(state.get_pred(5), 2u);
+    EXPECT_EQ(state.get_pred(1), 0u);
+}
+
+TEST_F(ZeroWeightContractionTest, CollapsesVertexCycles) {
+    // Constant-degree style input: every original vertex is a zero-weight
+    // cycle of 3 copies, original edges attach to random copies
+    const int n = 40, copies = 3;
+    Graph G;
+    for (int i = 0; i < n * copies; ++i) G.add_vertex(i);
+    for (int v = 0; v < n; ++v) {
+        for (int c = 0; c < copies; ++c) G.add_edge(v * copies + c, v * copies + (c + 1) % copies, 0.0);
+    }
+    std::mt19937 rng(6);
+    std::uniform_int_distribution<int> vid(0, n - 1), cid(0, copies - 1);
+    std::uniform_real_distribution<double> w(1.0, 5.0);
+    for (int i = 0; i < 200; ++i) {
+        G.add_edge(vid(rng) * copies + cid(rng), vid(rng) * copies + cid(rng), w(rng));
+    }
+
+    auto z = ZeroWeightContraction::build(G);
+    EXPECT_EQ(z.num_components(), static_cast<std::size_t>(n));
+    EXPECT_LE(z.contracted().num_edges(), 200u);
+    for (VertexId s : {0, 17, 119}) expect_matches(G, z, s);
+}
+
+TEST_F(ZeroWeightContractionTest, RandomZeroHeavyGraphs) {
+    std::mt19937 rng(21);
+    for (int trial = 0; trial < 20; ++trial) {
+        Graph G;
+        const int n = 50;
+        for (int i = 0; i < n; ++i) G.add_vertex(i);
+        std::uniform_int_distribution<int> vid(0, n - 1);
+        std::uniform_int_distribution<int> w(0, 3);   // about a quarter of the edges are zero
+        for (int i = 0; i < 180; ++i) G.add_edge(vid(rng), vid(rng), w(rng));
+        auto z = ZeroWeightContraction::build(G);
+        expect_matches(G, z, static_cast<VertexId>(vid(rng)));
+    }
+}
+
+int main(int argc, char** argv) {
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -2,6 +2,8 @@
 #include "sssp/graph.hpp"
 #include "sssp/types.hpp"
 #include <gtest/gtest.h>
+#include <random>
+#include <queue>
 
 using namespace sssp;
 
@@ -79,6 +81,114 @@ TEST_F(BaseCaseTest, DisconnectedGraph) {
     EXPECT_EQ(state.get(0), 0.0);
 }
 
+TEST_F(BaseCaseTest, StopsAfterKPlusOneVertices) {
+    // Path 0 -> 1 -> ... -> 9, unit weights
+    Graph G;
+    for (int i = 0; i < 10; ++i) G.add_vertex(i);
+    for (int i = 0; i + 1 < 10; ++i) G.add_edge(i, i + 1, 1.0);
+
+    DistState state;
+    state.init(G.num_vertices());
+    const long long pops_before = prof().basecase_pops.load();
+    auto r = BaseCase::run(G, 100.0, Vertex(0), state, 3);
+
+    EXPECT_EQ(prof().basecase_pops.load() - pops_before, 4);
+    ASSERT_EQ(r.U.size(), 4u);
+    for (int i = 0; i < 4; ++i) EXPECT_EQ(r.U[i], Vertex(i));
+    EXPECT_EQ(r.B_prime, 4.0);   // smallest distance left unsettled
+    EXPECT_EQ(state.get(4), 4.0);
+}
+
+TEST_F(BaseCaseTest, TiesAtTheBoundarySettleTogether) {
+    // Star: 0 -> 1..6 all at distance 1. With k = 2 the third vertex ties with
+    // the rest, which must not be split across B'.
+    Graph G;
+    for (int i = 0; i < 7; ++i) G.add_vertex(i);
+    for (int i = 1; i < 7; ++i) G.add_edge(0, i, 1.0);
+
+    DistState state;
+    state.init(G.num_vertices());
+    auto r = BaseCase::run(G, 100.0, Vertex(0), state, 2);
+
+    EXPECT_EQ(r.U.size(), 7u);
+    EXPECT_EQ(r.B_prime, 100.0);   // exhausted below B
+}
+
+TEST_F(BaseCaseTest, ZeroWeightCycleSettlesOnce) {
+    // 1 -> 2 -> 3 -> 1 is a zero-weight cycle: equal-distance relaxations must
+    // not re-open settled vertices or move their preds around the cycle
+    Graph G;
+    for (int i = 0; i < 5; ++i) G.add_vertex(i);
+    G.add_edge(0, 1, 1.0);
+    G.add_edge(1, 2, 0.0);
+    G.add_edge(2, 3, 0.0);
+    G.add_edge(3, 1, 0.0);
+    G.add_edge(3, 4, 2.0);
+
+    DistState state;
+    state.init(G.num_vertices());
+    auto r = BaseCase::run(G, 100.0, Vertex(0), state, G.num_vertices());
+
+    EXPECT_EQ(r.U.size(), 5u);
+    EXPECT_EQ(r.B_prime, 100.0);
+    const Weight expected[] = {0.0, 1.0, 1.0, 1.0, 3.0};
+    for (VertexId v = 0; v < 5; ++v) {
+        EXPECT_EQ(state.get(v), expected[v]) << v;
+        VertexId hop = v;
+        for (int steps = 0; steps <= 5 && state.has_pred(hop); ++steps) hop = state.get_pred(hop);
+        EXPECT_EQ(hop, 0u) << v;
+    }
+}
+
+TEST_F(BaseCaseTest, PerCallWorkBound) {
+    // Random graph with distinct real weights: every call pops at most k + 1
+    // vertices, U is exactly the set with d < B', and those distances are final.
+    const int n = 300;
+    Graph G;
+    for (int i = 0; i < n; ++i) G.add_vertex(i);
+    std::mt19937 rng(5);
+    std::uniform_int_distribution<int> vid(0, n - 1);
+    std::uniform_real_distribution<double> w(0.5, 5.0);
+    std::vector<std::vector<std::pair<int, double>>> adj(n);
+    for (int i = 0; i < 4 * n; ++i) {
+        int u = vid(rng), v = vid(rng);
+        double c = w(rng);
+        G.add_edge(u, v, c);
+        adj[u].push_back({v, c});
+    }
+
+    for (std::size_t k : {1u, 2u, 5u, 17u}) {
+        for (int s = 0; s < n; s += 29) {
+            std::vector<double> d(n, INFINITE_WEIGHT);
+            std::priority_queue<std::pair<double, int>, std::vector<std::pair<double, int>>, std::greater<>> pq;
+            d[s] = 0.0;
+            pq.push({0.0, s});
+            while (!pq.empty()) {
+                auto [du, u] = pq.top();
+                pq.pop();
+                if (du > d[u]) continue;
+                for (auto [v, c] : adj[u]) {
+                    if (du + c < d[v]) pq.push({d[v] = du + c, v});
+                }
+            }
+
+            DistState state;
+            state.init(G.num_vertices());
+            const long long pops_before = prof().basecase_pops.load();
+            auto r = BaseCase::run(G, INFINITE_WEIGHT, Vertex(s), state, k);
+            EXPECT_LE(prof().basecase_pops.load() - pops_before, static_cast<long long>(k + 1));
+
+            std::size_t below = 0;
+            for (int v = 0; v < n; ++v) below += d[v] < r.B_prime;
+            EXPECT_EQ(r.U.size(), below) << "k=" << k << " s=" << s;
+            for (auto u : r.U) {
+                EXPECT_LT(state.get(u.id()), r.B_prime);
+                EXPECT_NEAR(state.get(u.id()), d[u.id()], 1e-9);
+            }
+        }
+    }
+}
+
 int main(int argc, char** argv) {
     ::testing::InitGoogleTest(&argc, argv);
     return RUN_ALL_TESTS();
@@ -1,8 +1,10 @@
 #include "sssp/bmssp.hpp"
+#include "sssp/api.hpp"
 #include "sssp/graph.hpp"
 #include "sssp/types.hpp"
 #include <gtest/gtest.h>
 #include <cmath>
+#include <random>
 
 
 using namespace sssp;
@@ -90,6 +92,227 @@ TEST_F(BMSSPTest, DisconnectedGraph) {
     EXPECT_EQ(state.get(0), 0.0);  // Source should remain at 0
 }
 
+TEST_F(BMSSPTest, CyclicGraphWithZeroWeights) {
+    // Cycles and zero-weight edges used to keep re-queuing complete vertices
+    Graph G;
+    for (int i = 0; i < 6; ++i) G.add_vertex(i);
+    G.add_edge(0, 1, 1.0);
+    G.add_edge(1, 2, 0.0);
+    G.add_edge(2, 1, 0.0);
+    G.add_edge(2, 3, 2.0);
+    G.add_edge(3, 0, 1.0);
+    G.add_edge(3, 4, 1.0);
+    G.add_edge(4, 2, 0.5);
+    G.add_edge(4, 5, 3.0);
+
+    DistState state;
+    state.init(G.num_vertices());
+    Vertex s(0);
+    state.set(s.id(), 0.0);
+    std::vector<Vertex> S = {s};
+
+    std::size_t k = G.get_k();
+    std::size_t t = G.get_t();
+    int l = (int)((std::log((double)std::max<std::size_t>(G.num_vertices(), 1))) /
+                   (double)std::max<std::size_t>(t, 1)) + 1;
+
+    BMSSP::run(G, l, std::numeric_limits<Weight>::infinity(), S, state, k, t);
+
+    const Weight expected[] = {0.0, 1.0, 1.0, 3.0, 4.0, 7.0};
+    for (int v = 0; v < 6; ++v) EXPECT_EQ(state.get(v), expected[v]);
+    EXPECT_FALSE(state.has_pred(0));
+    EXPECT_EQ(state.get_pred(5), 4u);
+}
+
+TEST_F(BMSSPTest, ReverseSingleTarget) {
+    // Random digraph; the reverse search must match a forward search on an
+    // explicitly reversed copy, and successors must lead to the target.
+    Graph G, R;
+    const int n = 60;
+    for (int i = 0; i < n; ++i) { G.add_vertex(i); R.add_vertex(i); }
+    std::mt19937 rng(4);
+    std::uniform_int_distribution<int> vid(0, n - 1);
+    std::uniform_real_distribution<double> w(0.0, 5.0);
+    for (int i = 0; i < 240; ++i) {
+        int u = vid(rng), v = vid(rng);
+        double c = w(rng);
+        G.add_edge(u, v, c);
+        R.add_edge(v, u, c);
+    }
+
+    const Vertex target(7);
+    DistState rev, fwd;
+    solveReverseSSSP(G, target, rev);
+    solveSSSP(R, target, fwd);
+    for (VertexId v = 0; v < (VertexId)n; ++v) {
+        EXPECT_NEAR(rev.get(v), fwd.get(v), 1e-9) << v;
+        if (v == target.id() || rev.get(v) == INFINITE_WEIGHT) continue;
+        ASSERT_TRUE(rev.has_pred(v));
+        const VertexId next = rev.get_pred(v);
+        Weight best = INFINITE_WEIGHT;
+        for (const auto& e : G.get_outgoing_edges(Vertex(v))) {
+            if (e.destination().id() == next) best = std::min(best, e.weight());
+        }
+        EXPECT_NEAR(best + rev.get(next), rev.get(v), 1e-9) << v;
+    }
+    EXPECT_FALSE(rev.has_pred(target.id()));
+
+    auto [dist, succ] = solveReverseSSSP(G, target);
+    EXPECT_EQ(dist.at(target), 0.0);
+    EXPECT_EQ(succ.count(target), 0u);
+}
+
+TEST_F(BMSSPTest, PartialFrameReturnsOnlyVerticesBelowBPrime) {
+    // Star 0 -> 1..12 at distances 1..12, each leaf with a tail. With k = 2
+    // FindPivots puts all leaves into W, but a frame bounded by k 2^{lt} = 4
+    // stops early and only the leaves below B' are complete.
+    Graph G;
+    const int leaves = 12;
+    for (int i = 0; i <= 2 * leaves; ++i) G.add_vertex(i);
+    for (int i = 1; i <= leaves; ++i) {
+        G.add_edge(0, i, (double)i);
+        G.add_edge(i, leaves + i, 0.5);
+    }
+    const int n = (int)G.num_vertices();
+    DistState reference;
+    reference.init(n);
+    reference.set(0, 0.0);
+    BaseCase::run(G, INFINITE_WEIGHT, Vertex(0), reference, n);
+
+    // The frame overload takes l as given (top-level calls raise it to
+    // top_level(n, t)), so this frame is an inner one cut short
+    DistState state;
+    state.init(n);
+    state.set(0, 0.0);
+    auto res = BMSSP::run(G, 1, INFINITE_WEIGHT, {Vertex(0)}, state, 2, 1);
+
+    ASSERT_LT(res.B_prime, INFINITE_WEIGHT);
+    std::size_t below = 0;
+    for (VertexId v = 0; v < (VertexId)n; ++v) below += reference.get(v) < res.B_prime;
+    EXPECT_EQ(res.U.size(), below);
+    for (const auto& u : res.U) {
+        EXPECT_LT(state.get(u.id()), res.B_prime) << u.id();
+        EXPECT_EQ(state.get(u.id()), reference.get(u.id())) << u.id();
+    }
+}
+
+TEST_F(BMSSPTest, DijkstraCutoffKeepsDistances) {
+    // Small k and t give several levels with frame bounds 8, 32, 128, ...,
+    // so intermediate cutoffs mix Dijkstra frames with recursive ones.
+    Graph G;
+    const int n = 200;
+    for (int i = 0; i < n; ++i) G.add_vertex(i);
+    std::mt19937 rng(9);
+    std::uniform_int_distribution<int> vid(0, n - 1);
+    std::uniform_real_distribution<double> w(0.1, 10.0);
+    for (int i = 0; i < 4 * n; ++i) G.add_edge(vid(rng), vid(rng), w(rng));
+
+    const std::size_t k = 2, t = 2;
+    const int l = BMSSP::top_level(n, t);
+    auto solve = [&](std::size_t cutoff) {
+        BMSSPParams p;
+        p.k = k;
+        p.t = t;
+        p.l = l;
+        p.dijkstra_cutoff = cutoff;
+        DistState state;
+        state.init(n);
+        state.set(0, 0.0);
+        BMSSP::run(G, p, INFINITE_WEIGHT, {Vertex(0)}, state);
+        return state;
+    };
+    const DistState recursive = solve(1);
+    DistState reference;
+    reference.init(n);
+    reference.set(0, 0.0);
+    BaseCase::run(G, INFINITE_WEIGHT, Vertex(0), reference, n);
+    for (std::size_t cutoff : {std::size_t(1), std::size_t(8), std::size_t(32), std::size_t(512),
+                               std::numeric_limits<std::size_t>::max()}) {
+        const DistState hybrid = solve(cutoff);
+        for (VertexId v = 0; v < (VertexId)n; ++v) {
+            const Weight want = reference.get(v);
+            if (want == INFINITE_WEIGHT) {
+                ASSERT_EQ(hybrid.get(v), want) << "cutoff=" << cutoff << " v=" << v;
+                ASSERT_EQ(recursive.get(v), want) << v;
+                continue;
+            }
+            ASSERT_NEAR(hybrid.get(v), want, 1e-9) << "cutoff=" << cutoff << " v=" << v;
+            ASSERT_NEAR(recursive.get(v), want, 1e-9) << v;
+        }
+    }
+    EXPECT_EQ(BMSSP::resolve(BMSSPParams(), n).dijkstra_cutoff, BMSSP::kDefaultDijkstraCutoff);
+}
+
+TEST_F(BMSSPTest, DefaultCutoffRecursesAboveIt) {
+    // The tuner sees every frame that takes the recursive path
+    auto recursive_frames = [](int n) {
+        Graph G;
+        for (int i = 0; i < n; ++i) G.add_vertex(i);
+        std::mt19937 rng(13);
+        std::uniform_int_distribution<int> vid(0, n - 1);
+        std::uniform_real_distribution<double> w(0.1, 10.0);
+        for (int i = 0; i < 3 * n; ++i) G.add_edge(vid(rng), vid(rng), w(rng));
+        DistState reference;
+        reference.init(n);
+        reference.set(0, 0.0);
+        BaseCase::run(G, INFINITE_WEIGHT, Vertex(0), reference, n);
+
+        BMSSPParams p;
+        p.adaptive = true;
+        FrameTuner tuner;
+        DistState state;
+        state.init(n);
+        state.set(0, 0.0);
+        BMSSP::run(G, p, INFINITE_WEIGHT, {Vertex(0)}, state, tuner);
+        for (VertexId v = 0; v < (VertexId)n; ++v) EXPECT_EQ(state.get(v), reference.get(v)) << v;
+        std::size_t frames = 0;
+        for (const auto& lv : tuner.levels()) frames += lv.frames;
+        return frames;
+    };
+    EXPECT_EQ(recursive_frames(500), 0u);
+    EXPECT_GT(recursive_frames((int)BMSSP::kDefaultDijkstraCutoff + 1000), 0u);
+}
+
+TEST_F(BMSSPTest, AdaptiveFramesKeepDistancesAndBounds) {
+    Graph G;
+    const int n = 400;
+    for (int i = 0; i < n; ++i) G.add_vertex(i);
+    std::mt19937 rng(5);
+    std::uniform_int_distribution<int> vid(0, n - 1);
+    std::uniform_int_distribution<int> w(1, 9);   // integer weights, many ties
+    for (int i = 0; i < 4 * n; ++i) G.add_edge(vid(rng), vid(rng), w(rng));
+
+    DistState reference;
+    reference.init(n);
+    reference.set(0, 0.0);
+    BaseCase::run(G, INFINITE_WEIGHT, Vertex(0), reference, n);
+
+    BMSSPParams p;
+    p.k = 4;
+    p.t = 2;
+    p.dijkstra_cutoff = 1;
+    FrameTuner tuner;
+    DistState state;
+    state.init(n);
+    state.set(0, 0.0);
+    BMSSP::run(G, p, INFINITE_WEIGHT, {Vertex(0)}, state, tuner);
+    for (VertexId v = 0; v < (VertexId)n; ++v) ASSERT_EQ(state.get(v), reference.get(v)) << v;
+
+    // k stays in [2, k] and M in [1, 2^{(l-1)t}]
+    std::size_t frames = 0;
+    const auto& levels = tuner.levels();
+    for (std::size_t l = 1; l < levels.size(); ++l) {
+        if (levels[l].frames == 0) continue;
+        frames += levels[l].frames;
+        EXPECT_GE(levels[l].k, 2u);
+        EXPECT_LE(levels[l].k, p.k);
+        EXPECT_GE(levels[l].M, 1u);
+        EXPECT_LE(levels[l].M, std::size_t(1) << ((l - 1) * p.t));
+        EXPECT_LE(levels[l].pivot_early_exits, levels[l].frames);
+    }
+    EXPECT_GT(frames, 0u);
+}
+
 int main(int argc, char** argv) {
     ::testing::InitGoogleTest(&argc, argv);
     return RUN_ALL_TESTS();
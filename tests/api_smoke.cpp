@@ -47,6 +47,26 @@ TEST_F(ApiSmokeTest, DistanceQueries) {
     EXPECT_EQ(distances[3], 10.0);
 }
 
+TEST_F(ApiSmokeTest, SolveIntoDistState) {
+    Graph G;
+    for (int i = 0; i < 4; ++i) G.add_vertex(i);
+    G.add_edge(0, 1, 1.0);
+    G.add_edge(1, 2, 1.5);
+    G.add_edge(0, 3, 10.0);
+
+    DistState state;
+    solveSSSP(G, Vertex(0), state);
+    ASSERT_EQ(state.dist.size(), 4u);
+    EXPECT_EQ(state.get(2), 2.5);
+    EXPECT_EQ(state.get_pred(2), 1u);
+    EXPECT_FALSE(state.has_pred(0));
+
+    // A missing source leaves every vertex unreached
+    solveSSSP(G, Vertex(9), state);
+    ASSERT_EQ(state.dist.size(), 4u);
+    for (VertexId v = 0; v < 4; ++v) EXPECT_EQ(state.get(v), INFINITE_WEIGHT);
+}
+
 int main(int argc, char** argv) {
     ::testing::InitGoogleTest(&argc, argv);
     return RUN_ALL_TESTS();